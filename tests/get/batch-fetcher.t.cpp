@@ -0,0 +1,302 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "tools/get/batch-fetcher.hpp"
+#include "tools/get/pipeline-interests-aimd.hpp"
+#include "tools/get/pipeline-interests-fixed.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/io-fixture.hpp"
+
+#include <ndn-cxx/security/validator-null.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <sstream>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_AUTO_TEST_SUITE(TestBatchFetcher)
+
+BOOST_AUTO_TEST_CASE(ParseList)
+{
+  std::istringstream is("/ndn/a\n"
+                        "\n"
+                        "# comment\n"
+                        "  /ndn/b/v=3   out-b\n"
+                        "/ndn/c/v=7\n");
+  auto items = BatchFetcher::parseList(is, "dir/");
+  BOOST_REQUIRE_EQUAL(items.size(), 3);
+  BOOST_CHECK_EQUAL(items[0].name, "/ndn/a");
+  BOOST_CHECK_EQUAL(items[0].outputPath, "dir/a");
+  BOOST_CHECK_EQUAL(items[1].name, Name("/ndn/b").appendVersion(3));
+  BOOST_CHECK_EQUAL(items[1].outputPath, "out-b");
+  BOOST_CHECK_EQUAL(items[2].name, Name("/ndn/c").appendVersion(7));
+  BOOST_CHECK_EQUAL(items[2].outputPath, "dir/c");
+
+  std::istringstream noDir("/ndn/a\n");
+  items = BatchFetcher::parseList(noDir);
+  BOOST_REQUIRE_EQUAL(items.size(), 1);
+  BOOST_CHECK_EQUAL(items[0].outputPath, "a");
+}
+
+BOOST_AUTO_TEST_CASE(ParseListErrors)
+{
+  std::istringstream extraField("/ndn/a out-a garbage\n");
+  BOOST_CHECK_THROW(BatchFetcher::parseList(extraField), BatchFetcher::Error);
+
+  std::istringstream duplicate("/ndn/a\n/ndn/b out-b\n/ndn/x/a\n");
+  BOOST_CHECK_THROW(BatchFetcher::parseList(duplicate), BatchFetcher::Error);
+
+  std::istringstream noFileName("/v=1\n");
+  BOOST_CHECK_THROW(BatchFetcher::parseList(noFileName), BatchFetcher::Error);
+}
+
+class BatchFetcherFixture : public IoFixture
+{
+protected:
+  BatchFetcherFixture()
+  {
+    options.isQuiet = true;
+    options.maxPipelineSize = 1;
+  }
+
+  ~BatchFetcherFixture() override
+  {
+    for (const auto& path : paths) {
+      std::filesystem::remove(path);
+    }
+  }
+
+  BatchFetcher::Item
+  makeItem(const std::string& prefix, const std::string& fileName)
+  {
+    auto path = std::filesystem::temp_directory_path() / fileName;
+    paths.push_back(path);
+    return {Name(prefix).appendVersion(1), path.string()};
+  }
+
+  /**
+   * @brief Reply to @p interest with the only segment of an object
+   */
+  void
+  replyWithContent(const Interest& interest, const std::string& content, bool isNack = false)
+  {
+    auto data = makeData(interest.getName());
+    data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+    data->setFinalBlock(name::Component::fromSegment(0));
+    if (isNack) {
+      data->setContentType(tlv::ContentType_Nack);
+    }
+    face.receive(*data);
+    advanceClocks(1_ms);
+  }
+
+  /**
+   * @brief Return the first Interest sent for the object @p prefix
+   */
+  Interest
+  findFirstInterest(const Name& prefix) const
+  {
+    auto it = std::find_if(face.sentInterests.begin(), face.sentInterests.end(), [&] (const Interest& interest) {
+      return interest.getName().getPrefix(-2) == prefix;
+    });
+    BOOST_REQUIRE(it != face.sentInterests.end());
+    return *it;
+  }
+
+  static std::string
+  readFile(const std::filesystem::path& path)
+  {
+    std::ifstream is(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(is), {});
+  }
+
+protected:
+  DummyClientFace face{m_io};
+  Options options;
+  std::vector<std::filesystem::path> paths;
+};
+
+BOOST_FIXTURE_TEST_CASE(ConcurrencyLimit, BatchFetcherFixture)
+{
+  BatchFetcher fetcher(face, security::getAcceptAllValidator(), options, [this] (RttEstimatorWithStats&) {
+    return std::make_unique<PipelineInterestsFixed>(face, options);
+  }, 2);
+
+  fetcher.run({makeItem("/ndn/a", "ndnget-batch-a.t"),
+               makeItem("/ndn/b", "ndnget-batch-b.t"),
+               makeItem("/ndn/c", "ndnget-batch-c.t")});
+  advanceClocks(1_ms);
+
+  // only the first two objects are requested
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentInterests[0].getName().getPrefix(-2), "/ndn/a");
+  BOOST_CHECK_EQUAL(face.sentInterests[1].getName().getPrefix(-2), "/ndn/b");
+  BOOST_CHECK_EQUAL(fetcher.m_active.size(), 2);
+
+  // the third object is started as soon as one transfer completes
+  replyWithContent(face.sentInterests[1], "content of b");
+  BOOST_CHECK_EQUAL(fetcher.getNCompleted(), 1);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 3);
+  BOOST_CHECK_EQUAL(face.sentInterests[2].getName().getPrefix(-2), "/ndn/c");
+
+  replyWithContent(face.sentInterests[2], "content of c");
+  replyWithContent(face.sentInterests[0], "content of a");
+
+  BOOST_CHECK_EQUAL(fetcher.getNCompleted(), 3);
+  BOOST_CHECK_EQUAL(fetcher.getNFailed(), 0);
+  BOOST_CHECK_EQUAL(fetcher.m_active.size(), 0);
+  BOOST_CHECK_EQUAL(readFile(paths[0]), "content of a");
+  BOOST_CHECK_EQUAL(readFile(paths[1]), "content of b");
+  BOOST_CHECK_EQUAL(readFile(paths[2]), "content of c");
+}
+
+BOOST_FIXTURE_TEST_CASE(FailureDoesNotStopBatch, BatchFetcherFixture)
+{
+  BatchFetcher fetcher(face, security::getAcceptAllValidator(), options, [this] (RttEstimatorWithStats&) {
+    return std::make_unique<PipelineInterestsFixed>(face, options);
+  }, 1);
+
+  fetcher.run({makeItem("/ndn/a", "ndnget-batch-nack.t"),
+               makeItem("/ndn/b", "ndnget-batch-ok.t")});
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+
+  replyWithContent(face.sentInterests[0], "application nack", true);
+  BOOST_CHECK_EQUAL(fetcher.getNFailed(), 1);
+  BOOST_CHECK_EQUAL(fetcher.m_failed.size(), 1);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+
+  replyWithContent(face.sentInterests[1], "content of b");
+  BOOST_CHECK_EQUAL(fetcher.getNCompleted(), 1);
+  BOOST_CHECK_EQUAL(fetcher.getNFailed(), 1);
+  BOOST_CHECK_EQUAL(readFile(paths[1]), "content of b");
+}
+
+BOOST_FIXTURE_TEST_CASE(WindowHandoff, BatchFetcherFixture)
+{
+  std::vector<PipelineInterestsAdaptive*> pipelines;
+  std::vector<RttEstimatorWithStats*> rttEstimators;
+  BatchFetcher fetcher(face, security::getAcceptAllValidator(), options,
+    [&] (RttEstimatorWithStats& rttEstimator) {
+      auto pipeline = std::make_unique<PipelineInterestsAimd>(face, rttEstimator, options);
+      pipelines.push_back(pipeline.get());
+      rttEstimators.push_back(&rttEstimator);
+      return pipeline;
+    }, 1);
+
+  fetcher.run({makeItem("/ndn/a", "ndnget-batch-w1.t"),
+               makeItem("/ndn/b", "ndnget-batch-w2.t")});
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(pipelines.size(), 1);
+  BOOST_CHECK(!fetcher.m_windowState);
+  pipelines[0]->setWindowState({12.0, 10.0});
+
+  // the second transfer starts from the window reached by the first one
+  replyWithContent(face.sentInterests[0], "content of a");
+  BOOST_REQUIRE(fetcher.m_windowState);
+  BOOST_REQUIRE_EQUAL(pipelines.size(), 2);
+  BOOST_CHECK_EQUAL(pipelines[1]->getWindowState().ssthresh, fetcher.m_windowState->ssthresh);
+  BOOST_CHECK_EQUAL(pipelines[1]->getWindowState().cwnd, fetcher.m_windowState->cwnd);
+  BOOST_CHECK_GT(pipelines[1]->getWindowState().cwnd, options.initCwnd);
+  BOOST_REQUIRE_EQUAL(rttEstimators.size(), 2);
+  BOOST_CHECK_NE(rttEstimators[0], rttEstimators[1]);
+}
+
+BOOST_FIXTURE_TEST_CASE(SharedWindow, BatchFetcherFixture)
+{
+  std::vector<PipelineInterestsAdaptive*> pipelines;
+  std::set<RttEstimatorWithStats*> rttEstimators;
+  BatchFetcher fetcher(face, security::getAcceptAllValidator(), options,
+    [&] (RttEstimatorWithStats& rttEstimator) {
+      auto pipeline = std::make_unique<PipelineInterestsAimd>(face, rttEstimator, options);
+      pipelines.push_back(pipeline.get());
+      rttEstimators.insert(&rttEstimator);
+      return pipeline;
+    }, 2);
+
+  fetcher.run({makeItem("/ndn/a", "ndnget-batch-s1.t"),
+               makeItem("/ndn/b", "ndnget-batch-s2.t"),
+               makeItem("/ndn/c", "ndnget-batch-s3.t")});
+  advanceClocks(1_ms);
+
+  // the window owner and the pipelines of the first two transfers share one RTT estimator
+  BOOST_REQUIRE_EQUAL(pipelines.size(), 3);
+  BOOST_CHECK(fetcher.m_windowOwner.get() == pipelines[0]);
+  BOOST_CHECK_EQUAL(rttEstimators.size(), 1);
+  auto& owner = *pipelines[0];
+  owner.setWindowState({4.0, 4.0});
+
+  // answer version discovery with the first of 100 segments, the pipelines start fetching
+  auto replyWithSegment = [this] (const Name& name) {
+    auto data = makeData(name);
+    data->setContent(make_span(reinterpret_cast<const uint8_t*>("0123456789"), 10));
+    data->setFinalBlock(name::Component::fromSegment(99));
+    face.receive(*data);
+    advanceClocks(1_ms);
+  };
+  replyWithSegment(findFirstInterest("/ndn/a").getName());
+  replyWithSegment(findFirstInterest("/ndn/b").getName());
+
+  // the first transfer has filled the shared window, the second one waits for room
+  auto& a = *pipelines[1];
+  auto& b = *pipelines[2];
+  BOOST_CHECK_EQUAL(a.getCounters().nInFlight, 4);
+  BOOST_CHECK_EQUAL(b.getCounters().nInFlight, 0);
+  BOOST_CHECK_EQUAL(a.getWindowState().cwnd, 4.0);
+  BOOST_CHECK_EQUAL(b.getWindowState().cwnd, 4.0);
+
+  // a Data packet of the first transfer grows the shared window and makes room for the second one
+  replyWithSegment(Name("/ndn/a").appendVersion(1).appendSegment(1));
+  BOOST_CHECK_EQUAL(owner.getWindowState().cwnd, 4.25);
+  BOOST_CHECK_EQUAL(a.getWindowState().cwnd, 4.25);
+  BOOST_CHECK_EQUAL(b.getWindowState().cwnd, 4.25);
+  BOOST_CHECK_EQUAL(a.getCounters().nInFlight, 3);
+  BOOST_CHECK_EQUAL(b.getCounters().nInFlight, 1);
+  BOOST_CHECK((*rttEstimators.begin())->getMinRtt() != time::nanoseconds::max());
+
+  // a Data packet of the second transfer grows the same window, which stays full
+  auto bInterest = std::find_if(face.sentInterests.begin(), face.sentInterests.end(), [] (const Interest& interest) {
+    return interest.getName().getPrefix(-2) == "/ndn/b" && interest.getName().at(-1).toSegment() > 0;
+  });
+  BOOST_REQUIRE(bInterest != face.sentInterests.end());
+  replyWithSegment(bInterest->getName());
+  BOOST_CHECK_GT(owner.getWindowState().cwnd, 4.25);
+  BOOST_CHECK_EQUAL(a.getCounters().nInFlight + b.getCounters().nInFlight,
+                    static_cast<int64_t>(owner.getWindowState().cwnd));
+  BOOST_CHECK_GE(b.getCounters().nInFlight, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBatchFetcher
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
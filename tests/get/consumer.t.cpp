@@ -26,6 +26,7 @@
 #include "tools/get/consumer.hpp"
 #include "tools/get/discover-version.hpp"
 #include "tools/get/pipeline-interests.hpp"
+#include "tools/get/pipeline-interests-fixed.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/io-fixture.hpp"
@@ -35,6 +36,11 @@
 
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
 namespace ndn::tests {
 
 using namespace ndn::get;
@@ -72,7 +78,7 @@ BOOST_AUTO_TEST_CASE(InOrderData)
     data->setContent(make_span(reinterpret_cast<const uint8_t*>(testStrings[i].data()),
                                testStrings[i].size()));
 
-    cons.m_bufferedData[i] = data;
+    cons.m_reorderBuffer.insert(i, data);
     cons.writeInOrderData();
 
     BOOST_CHECK(output.is_equal(testStrings[i]));
@@ -110,19 +116,199 @@ BOOST_AUTO_TEST_CASE(OutOfOrderData)
   }
 
   output.flush();
-  cons.m_bufferedData[1] = dataStore[1];
+  cons.m_reorderBuffer.insert(1, dataStore[1]);
   cons.writeInOrderData();
   BOOST_CHECK(output.is_equal(""));
 
   output.flush();
-  cons.m_bufferedData[0] = dataStore[0];
+  cons.m_reorderBuffer.insert(0, dataStore[0]);
   cons.writeInOrderData();
   BOOST_CHECK(output.is_equal(testStrings[0] + testStrings[1]));
 
   output.flush();
-  cons.m_bufferedData[2] = dataStore[2];
+  cons.m_reorderBuffer.insert(2, dataStore[2]);
   cons.writeInOrderData();
   BOOST_CHECK(output.is_equal(testStrings[2]));
+
+  BOOST_CHECK_EQUAL(cons.m_reorderBuffer.size(), 0);
+  BOOST_CHECK_EQUAL(cons.m_reorderBuffer.getHighWaterMark(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(FileOutput)
+{
+  // Segment order: 2 3 1 0
+
+  const std::string name("/ndn/chunks/test");
+  const std::vector<std::string> testStrings {
+      "0123456789",
+      "abcdefghij",
+      "ABCDEFGHIJ",
+      "tail",
+  };
+
+  auto path = std::filesystem::temp_directory_path() / "ndnget-consumer-file-output.t";
+  std::string expected;
+  {
+    FileWriter file(path.string());
+    Consumer cons(security::getAcceptAllValidator(), file);
+
+    std::vector<std::shared_ptr<Data>> dataStore;
+    for (size_t i = 0; i < testStrings.size(); ++i) {
+      auto data = makeData(Name(name).appendVersion(1).appendSegment(i));
+      data->setContent(make_span(reinterpret_cast<const uint8_t*>(testStrings[i].data()),
+                                 testStrings[i].size()));
+      data->setFinalBlock(name::Component::fromSegment(testStrings.size() - 1));
+      dataStore.push_back(data);
+      expected += testStrings[i];
+    }
+
+    cons.writeToFile(dataStore[2]);
+    BOOST_CHECK_EQUAL(cons.m_segmentSize, 10);
+    BOOST_CHECK_EQUAL(cons.m_pendingWrites.size(), 0);
+
+    cons.writeToFile(dataStore[3]);
+    cons.writeToFile(dataStore[1]);
+    cons.writeToFile(dataStore[0]);
+    BOOST_CHECK_EQUAL(cons.m_reorderBuffer.size(), 0);
+  }
+
+  std::ifstream is(path, std::ios::binary);
+  std::string actual(std::istreambuf_iterator<char>(is), {});
+  BOOST_CHECK_EQUAL(actual, expected);
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(FileOutputUnknownSegmentSize)
+{
+  // Segment order: 2 (last) 0 1
+
+  const std::string name("/ndn/chunks/test");
+  auto path = std::filesystem::temp_directory_path() / "ndnget-consumer-file-output-2.t";
+  {
+    FileWriter file(path.string());
+    Consumer cons(security::getAcceptAllValidator(), file);
+
+    auto makeSegment = [&] (uint64_t segNo, const std::string& content) {
+      auto data = makeData(Name(name).appendVersion(1).appendSegment(segNo));
+      data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+      data->setFinalBlock(name::Component::fromSegment(2));
+      return data;
+    };
+
+    // the offset of the last segment cannot be computed yet
+    cons.writeToFile(makeSegment(2, "zz"));
+    BOOST_CHECK_EQUAL(cons.m_pendingWrites.size(), 1);
+
+    cons.writeToFile(makeSegment(0, "xxxx"));
+    BOOST_CHECK_EQUAL(cons.m_segmentSize, 4);
+    BOOST_CHECK_EQUAL(cons.m_pendingWrites.size(), 0);
+
+    BOOST_CHECK_THROW(cons.writeToFile(makeSegment(1, "yyy")), std::runtime_error);
+    cons.writeToFile(makeSegment(1, "yyyy"));
+  }
+
+  std::ifstream is(path, std::ios::binary);
+  std::string actual(std::istreambuf_iterator<char>(is), {});
+  BOOST_CHECK_EQUAL(actual, "xxxxyyyyzz");
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(FileOutputSegmentSizeFromLowerSegment)
+{
+  // Segment order: 2 1 0 3 (last), only the last segment carries a FinalBlockId
+
+  const std::string name("/ndn/chunks/test");
+  auto path = std::filesystem::temp_directory_path() / "ndnget-consumer-file-output-4.t";
+  {
+    FileWriter file(path.string());
+    Consumer cons(security::getAcceptAllValidator(), file);
+
+    auto makeSegment = [&] (uint64_t segNo, const std::string& content) {
+      auto data = makeData(Name(name).appendVersion(1).appendSegment(segNo));
+      data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+      if (segNo == 3) {
+        data->setFinalBlock(name::Component::fromSegment(3));
+      }
+      return data;
+    };
+
+    cons.writeToFile(makeSegment(2, "zzzz"));
+    BOOST_CHECK_EQUAL(cons.m_segmentSize, 0);
+    BOOST_CHECK_EQUAL(cons.m_pendingWrites.size(), 1);
+    // the segment waiting for its offset counts towards the backlog
+    BOOST_CHECK_EQUAL(cons.getBacklog(), 1);
+
+    // segment 1 is not the last one, since a later segment exists
+    cons.writeToFile(makeSegment(1, "yyyy"));
+    BOOST_CHECK_EQUAL(cons.m_segmentSize, 4);
+    BOOST_CHECK_EQUAL(cons.m_pendingWrites.size(), 0);
+    BOOST_CHECK_EQUAL(cons.getBacklog(), 0);
+
+    cons.writeToFile(makeSegment(0, "xxxx"));
+    BOOST_CHECK_EQUAL(cons.hasWrittenAllSegments(), false);
+
+    cons.writeToFile(makeSegment(3, "w"));
+    BOOST_CHECK_EQUAL(cons.hasWrittenAllSegments(), true);
+  }
+
+  std::ifstream is(path, std::ios::binary);
+  std::string actual(std::istreambuf_iterator<char>(is), {});
+  BOOST_CHECK_EQUAL(actual, "xxxxyyyyzzzzw");
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(FileOutputResume)
+{
+  const std::string name("/ndn/chunks/test");
+  auto path = std::filesystem::temp_directory_path() / "ndnget-consumer-file-output-3.t";
+  auto statePath = std::filesystem::temp_directory_path() / "ndnget-consumer-file-output-3.state";
+  std::filesystem::remove(statePath);
+
+  auto makeSegment = [&] (uint64_t segNo, const std::string& content, uint64_t lastSegNo = 2) {
+    auto data = makeData(Name(name).appendVersion(1).appendSegment(segNo));
+    data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+    data->setFinalBlock(name::Component::fromSegment(lastSegNo));
+    return data;
+  };
+
+  {
+    ResumeState state(statePath.string());
+    state.reset(Name(name).appendVersion(1));
+    FileWriter file(path.string());
+    Consumer cons(security::getAcceptAllValidator(), file);
+    cons.setResumeState(state);
+
+    cons.writeToFile(makeSegment(2, "zz"));
+    BOOST_CHECK(!state.hasLayout());
+    cons.writeToFile(makeSegment(0, "xxxx"));
+    BOOST_CHECK(state.hasLayout());
+    BOOST_CHECK_EQUAL(state.getLastSegmentNo(), 2);
+    BOOST_CHECK_EQUAL(state.getSegmentSize(), 4);
+    BOOST_CHECK_EQUAL(state.getNWritten(), 2);
+
+    BOOST_CHECK_THROW(cons.writeToFile(makeSegment(1, "yyyy", 3)), std::runtime_error);
+    BOOST_CHECK(!state.isWritten(1));
+  }
+
+  {
+    // the output file is not truncated when the transfer is resumed
+    ResumeState state(statePath.string());
+    FileWriter file(path.string(), false);
+    Consumer cons(security::getAcceptAllValidator(), file);
+    cons.setResumeState(state);
+    cons.m_hasLastSegmentNo = true;
+    cons.m_lastSegmentNo = state.getLastSegmentNo();
+    cons.m_segmentSize = state.getSegmentSize();
+
+    cons.writeToFile(makeSegment(1, "yyyy"));
+    BOOST_CHECK_EQUAL(state.getNWritten(), 3);
+  }
+
+  std::ifstream is(path, std::ios::binary);
+  std::string actual(std::istreambuf_iterator<char>(is), {});
+  BOOST_CHECK_EQUAL(actual, "xxxxyyyyzz");
+  std::filesystem::remove(path);
+  std::filesystem::remove(statePath);
 }
 
 class PipelineInterestsDummy final : public PipelineInterests
@@ -166,6 +352,62 @@ BOOST_FIXTURE_TEST_CASE(RunBasic, IoFixture)
   BOOST_CHECK_EQUAL(pipelinePtr->isPipelineRunning, true);
 }
 
+BOOST_FIXTURE_TEST_CASE(FileOutputFinalBlockIdOnLastSegment, IoFixture)
+{
+  const uint64_t lastSegmentNo = 7;
+  std::string expected;
+  for (uint64_t segNo = 0; segNo < lastSegmentNo; ++segNo) {
+    expected += std::string(4, static_cast<char>('a' + segNo));
+  }
+  expected += "z";
+
+  for (size_t maxBufferSize : {0, 1}) {
+    BOOST_TEST_CONTEXT("maxBufferSize=" << maxBufferSize) {
+      DummyClientFace face(m_io);
+      Options options;
+      options.isQuiet = true;
+      options.maxPipelineSize = 4;
+      options.maxBufferSize = maxBufferSize;
+
+      auto path = std::filesystem::temp_directory_path() / "ndnget-consumer-file-output-5.t";
+      {
+        FileWriter file(path.string());
+        Consumer consumer(security::getAcceptAllValidator(), file);
+        Name prefix = Name("/ndn/chunks/test").appendVersion(1);
+        consumer.run(std::make_unique<DiscoverVersion>(face, prefix, options),
+                     std::make_unique<PipelineInterestsFixed>(face, options));
+
+        for (int i = 0; i < 10 && !consumer.hasWrittenAllSegments(); ++i) {
+          advanceClocks(1_ms);
+          // answer in reverse order, so that later segments arrive before segment 0
+          auto interests = face.sentInterests;
+          face.sentInterests.clear();
+          std::reverse(interests.begin(), interests.end());
+          for (const auto& interest : interests) {
+            uint64_t segNo = interest.getName().at(-1).toSegment();
+            if (segNo > lastSegmentNo) {
+              continue;
+            }
+            auto data = makeData(interest.getName());
+            auto content = segNo == lastSegmentNo ? "z" : std::string(4, static_cast<char>('a' + segNo));
+            data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+            if (segNo == lastSegmentNo) {
+              data->setFinalBlock(name::Component::fromSegment(lastSegmentNo));
+            }
+            face.receive(*data);
+          }
+        }
+        BOOST_CHECK_EQUAL(consumer.hasWrittenAllSegments(), true);
+      }
+
+      std::ifstream is(path, std::ios::binary);
+      std::string actual(std::istreambuf_iterator<char>(is), {});
+      BOOST_CHECK_EQUAL(actual, expected);
+      std::filesystem::remove(path);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestConsumer
 BOOST_AUTO_TEST_SUITE_END() // Get
 
@@ -210,6 +210,70 @@ BOOST_AUTO_TEST_CASE(SuccessAfterNackAndTimeout)
   BOOST_CHECK_EQUAL(discoveredVersion.value(), version);
 }
 
+BOOST_AUTO_TEST_CASE(ProbeFirst)
+{
+  opt.enableVersionProbe = true;
+  run(name);
+
+  // the discovery Interest and the probe are sent at the same time
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentInterests[0].getName(), MetadataObject::makeDiscoveryInterest(name).getName());
+  BOOST_CHECK_EQUAL(face.sentInterests[1].getName(), name);
+  BOOST_CHECK_EQUAL(face.sentInterests[1].getCanBePrefix(), true);
+
+  // a segment of the object answers the probe before the metadata arrives
+  auto segment = makeData(Name(name).appendVersion(version).appendSegment(0));
+  segment->setFinalBlock(name::Component::fromSegment(9));
+  face.receive(*signData(segment));
+  advanceClocks(1_ns);
+  BOOST_CHECK_EQUAL(discoveredVersion.value(), version);
+  // its FinalBlockId is also known, and the segment can be handed to the pipeline
+  BOOST_CHECK_EQUAL(discover->getLastSegmentNo().value(), 9);
+  BOOST_REQUIRE(discover->getProbedData() != nullptr);
+  BOOST_CHECK_EQUAL(discover->getProbedData()->getName(), segment->getName());
+
+  // the metadata is no longer awaited
+  MetadataObject mobject;
+  mobject.setVersionedName(Name(name).appendVersion(version + 1));
+  face.receive(mobject.makeData(face.sentInterests[0].getName(), m_keyChain));
+  advanceClocks(1_ns);
+  BOOST_CHECK_EQUAL(discoveredVersion.value(), version);
+}
+
+BOOST_AUTO_TEST_CASE(ProbeUnusable)
+{
+  opt.enableVersionProbe = true;
+  run(name);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+
+  // the metadata packet also satisfies the probe, which cannot extract a version from it
+  MetadataObject mobject;
+  mobject.setVersionedName(Name(name).appendVersion(version));
+  face.receive(mobject.makeData(face.sentInterests[0].getName(), m_keyChain));
+  advanceClocks(1_ns);
+
+  BOOST_CHECK_EQUAL(discoveredVersion.value(), version);
+  BOOST_CHECK(!discover->getLastSegmentNo());
+  BOOST_CHECK(discover->getProbedData() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ProbeAndDiscoveryFail)
+{
+  opt.enableVersionProbe = true;
+  opt.maxRetriesOnTimeoutOrNack = 0;
+  run(name);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+
+  face.receive(makeNack(face.sentInterests[1], lp::NackReason::NO_ROUTE));
+  advanceClocks(1_ns);
+  BOOST_CHECK_EQUAL(isDiscoveryFinished, false);
+
+  face.receive(makeNack(face.sentInterests[0], lp::NackReason::NO_ROUTE));
+  advanceClocks(1_ns);
+  BOOST_CHECK_EQUAL(isDiscoveryFinished, true);
+  BOOST_CHECK_EQUAL(discoveredName.has_value(), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestDiscoverVersion
 BOOST_AUTO_TEST_SUITE_END() // Get
 
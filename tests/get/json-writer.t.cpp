@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "tools/get/json-writer.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <limits>
+#include <sstream>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_AUTO_TEST_SUITE(TestJsonWriter)
+
+BOOST_AUTO_TEST_CASE(Nested)
+{
+  std::ostringstream os;
+  JsonWriter json(os);
+  json.beginObject()
+      .member("schemaVersion", 1)
+      .member("error", nullptr)
+      .member("success", true);
+  json.beginObject("stats")
+      .member("received", uint64_t{18446744073709551615u})
+      .member("delta", int64_t{-3})
+      .member("rate", 0.25)
+      .endObject();
+  json.beginArray("paths")
+      .element("/a")
+      .element("/b")
+      .endArray();
+  json.beginArray("streams");
+  json.beginObject().member("cwnd", 2.0).endObject();
+  json.endArray();
+  json.beginArray("empty").endArray();
+  json.beginObject("none").endObject();
+  json.endObject();
+
+  BOOST_CHECK_EQUAL(os.str(),
+                    "{\n"
+                    "  \"schemaVersion\": 1,\n"
+                    "  \"error\": null,\n"
+                    "  \"success\": true,\n"
+                    "  \"stats\": {\n"
+                    "    \"received\": 18446744073709551615,\n"
+                    "    \"delta\": -3,\n"
+                    "    \"rate\": 0.25\n"
+                    "  },\n"
+                    "  \"paths\": [\n"
+                    "    \"/a\",\n"
+                    "    \"/b\"\n"
+                    "  ],\n"
+                    "  \"streams\": [\n"
+                    "    {\n"
+                    "      \"cwnd\": 2\n"
+                    "    }\n"
+                    "  ],\n"
+                    "  \"empty\": [],\n"
+                    "  \"none\": {}\n"
+                    "}\n");
+}
+
+BOOST_AUTO_TEST_CASE(Escaping)
+{
+  std::ostringstream os;
+  JsonWriter json(os);
+  json.beginObject()
+      .member("a\"b", "quote \" backslash \\ newline \n tab \t control \x01")
+      .endObject();
+
+  BOOST_CHECK_EQUAL(os.str(),
+                    "{\n"
+                    "  \"a\\\"b\": \"quote \\\" backslash \\\\ newline \\n tab \\t control \\u0001\"\n"
+                    "}\n");
+}
+
+BOOST_AUTO_TEST_CASE(NonFinite)
+{
+  std::ostringstream os;
+  JsonWriter json(os);
+  json.beginObject()
+      .member("inf", std::numeric_limits<double>::infinity())
+      .member("nan", std::numeric_limits<double>::quiet_NaN())
+      .endObject();
+
+  BOOST_CHECK_EQUAL(os.str(),
+                    "{\n"
+                    "  \"inf\": null,\n"
+                    "  \"nan\": null\n"
+                    "}\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestJsonWriter
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
@@ -184,13 +184,166 @@ BOOST_AUTO_TEST_CASE(Timeout)
   BOOST_CHECK_EQUAL(pipeline->m_nReceived, 6);
   BOOST_CHECK_CLOSE(pipeline->m_cwnd, 2.875, MARGIN); // congestion avoidance
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[3], 1);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(3), 1);
 
   BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 2);
   BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 2);
   BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, pipeline->m_nRetransmitted + pipeline->m_nSkippedRetx);
 }
 
+BOOST_AUTO_TEST_CASE(TimeoutAtDeadline)
+{
+  nDataSegments = 4;
+
+  // no RTT sample has been taken yet, so both Interests are sent with the initial RTO of 1s
+  run(name);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(pipeline->m_rtoTimers.size(), 2);
+
+  advanceClocks(time::milliseconds(999));
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+
+  // segment 0 is received, its timer becomes stale
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, 1);
+
+  // segment 1 times out exactly at its deadline, not at the next polling interval
+  advanceClocks(time::milliseconds(1) - time::nanoseconds(2));
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 1); // the window is full with segments 2 and 3
+}
+
+BOOST_AUTO_TEST_CASE(LifetimeExpirationInRetxQueue)
+{
+  opt.interestLifetime = 1500_ms;
+  createPipeline();
+
+  nDataSegments = 4;
+  run(name);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+
+  advanceClocks(time::milliseconds(999));
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+
+  // segment 1 times out after its initial RTO of 1s, the window is full with segments 2 and 3
+  advanceClocks(time::milliseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 1);
+  BOOST_REQUIRE_EQUAL(pipeline->m_retxQueue.size(), 1);
+  auto nInFlight = pipeline->m_nInFlight;
+
+  // the lifetime of the Interest for segment 1 expires while the segment is still in the
+  // retx queue, which must not count as another timeout
+  advanceClocks(time::milliseconds(500));
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nInFlight, nInFlight);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(AdaptiveLifetime)
+{
+  opt.enableAdaptiveLifetime = true;
+  opt.minLifetime = 200_ms;
+  opt.lifetimeMargin = 100_ms;
+  createPipeline();
+
+  BOOST_CHECK_EQUAL(pipeline->getInterestLifetime(50_ms), 200_ms);
+  BOOST_CHECK_EQUAL(pipeline->getInterestLifetime(10_s), opt.interestLifetime);
+
+  nDataSegments = 4;
+  run(name);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  // initial RTO of 1s plus the margin
+  BOOST_CHECK_EQUAL(face.sentInterests[0].getInterestLifetime(), 1100_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests[1].getInterestLifetime(), 1100_ms);
+
+  // both segments time out, and are retransmitted with the backed-off RTO of 2s
+  // while the previous Interests have not expired yet
+  advanceClocks(1_s);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 2);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(face.sentInterests[2].getInterestLifetime(), 2100_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests[3].getInterestLifetime(), 2100_ms);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 2);
+  BOOST_CHECK_EQUAL(pipeline->m_nRacingRetx, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ProbeFinalBlockId)
+{
+  nDataSegments = 3;
+  pipeline->m_cwnd = 8.0;
+
+  // without probing, the whole window is requested
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 8);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nOvershoot, 5);
+
+  opt.probeFinalBlockId = true;
+  createPipeline();
+  face.sentInterests.clear();
+  pipeline->m_cwnd = 8.0;
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), nDataSegments);
+
+  for (uint64_t segNo = 1; segNo < nDataSegments; ++segNo) {
+    face.receive(*makeDataWithSegment(segNo));
+    advanceClocks(time::nanoseconds(1));
+  }
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, nDataSegments);
+  BOOST_CHECK_EQUAL(pipeline->m_nOvershoot, 0);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(FastRetransmit)
+{
+  opt.enableFastRetx = true;
+  createPipeline();
+
+  nDataSegments = 10;
+  pipeline->m_cwnd = 6.0;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 6);
+
+  // segment 1 is lost, but it could merely be reordered until 3 later segments have arrived
+  for (uint64_t segNo : {0, 2, 3}) {
+    face.receive(*makeDataWithSegment(segNo));
+    advanceClocks(time::nanoseconds(1));
+  }
+  BOOST_CHECK_EQUAL(pipeline->m_nFastRetx, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 0);
+
+  face.receive(*makeDataWithSegment(4));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nFastRetx, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 5.0, MARGIN);
+  BOOST_REQUIRE(pipeline->m_segmentTable.find(1) != nullptr);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.find(1)->state, SegmentState::InRetxQueue);
+  BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 1); // the window is full
+
+  // segment 1 is not fast retransmitted twice
+  face.receive(*makeDataWithSegment(5));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nFastRetx, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 1);
+}
+
 BOOST_AUTO_TEST_CASE(CongestionMarksWithCwa)
 {
   nDataSegments = 7;
@@ -227,8 +380,8 @@ BOOST_AUTO_TEST_CASE(CongestionMarksWithCwa)
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
 
   // make sure no interest is retransmitted for marked data packets
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[5], 0);
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[nDataSegments - 1], 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 0);
 
   // check number of received marked data packets
   BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 2);
@@ -274,13 +427,56 @@ BOOST_AUTO_TEST_CASE(CongestionMarksWithoutCwa)
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
 
   // make sure no interest is retransmitted for marked data packets
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[5], 0);
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[nDataSegments - 1], 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 0);
 
   // check number of received marked data packets
   BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 2);
 }
 
+BOOST_AUTO_TEST_CASE(CongestionMarksDctcp)
+{
+  opt.enableDctcp = true;
+  createPipeline();
+
+  nDataSegments = 20;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_CLOSE(pipeline->getMarkingFraction(), 1.0, MARGIN);
+
+  // the first window covers the initial Interests (segments 0 and 1), so it does not end
+  // with the first Data packet
+  BOOST_CHECK_EQUAL(pipeline->m_markWindowEnd, 2);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_CLOSE(pipeline->getMarkingFraction(), 1.0, MARGIN);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 3.0, MARGIN);
+  face.receive(*makeDataWithSegment(1));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_CLOSE(pipeline->getMarkingFraction(), 1.0, MARGIN);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 4.0, MARGIN);
+
+  // it ends with segment 2, the first one requested after it started: one of three is marked
+  face.receive(*makeDataWithSegmentAndCongMark(2));
+  advanceClocks(time::nanoseconds(1));
+
+  double alpha = 15.0 / 16.0 + (1.0 / 3.0) / 16.0;
+  BOOST_CHECK_CLOSE(pipeline->getMarkingFraction(), alpha, MARGIN);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 4.0 * (1.0 - alpha / 2.0), MARGIN);
+  BOOST_CHECK_CLOSE(pipeline->m_ssthresh, pipeline->m_cwnd, MARGIN);
+  BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nMarkDecr, 1);
+
+  // the next marks in the same window do not decrease the window again
+  double cwnd = pipeline->m_cwnd;
+  face.receive(*makeDataWithSegmentAndCongMark(3));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, cwnd, MARGIN);
+  BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 2);
+  BOOST_CHECK_EQUAL(pipeline->m_nMarkDecr, 1);
+}
+
 BOOST_AUTO_TEST_CASE(IgnoreCongestionMarks)
 {
   opt.ignoreCongMarks = true;
@@ -313,7 +509,8 @@ BOOST_AUTO_TEST_CASE(IgnoreCongestionMarks)
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
 
   // make sure no interest is retransmitted for marked data packet
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[nDataSegments - 1], 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 0);
 
   // check number of received marked data packets
   BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 1);
@@ -351,7 +548,7 @@ BOOST_AUTO_TEST_CASE(Nack)
   advanceClocks(time::nanoseconds(1));
 
   // segment 2 is retransmitted
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[2], 1);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(2), 1);
 
   // receive a nack with NackReason::NONE for segment 3
   auto nack3 = makeNack(face.sentInterests[3], lp::NackReason::NONE);
@@ -471,7 +668,7 @@ BOOST_AUTO_TEST_CASE(SpuriousFailureBeforeFinalBlockIdReceived)
   advanceClocks(time::seconds(1));
 
   // segment 3 is retransmitted
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[3], 1);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(3), 1);
 
   // receive segment 3
   face.receive(*makeDataWithSegment(3));
@@ -482,7 +679,7 @@ BOOST_AUTO_TEST_CASE(SpuriousFailureBeforeFinalBlockIdReceived)
 
 BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
 {
-  // test that m_segmentInfo is properly maintained when
+  // test that m_segmentTable is properly maintained when
   // a segment is received after two consecutive timeouts
 
   nDataSegments = 3;
@@ -501,9 +698,9 @@ BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
 
   // check if segment 2's state is FirstTimeSent
-  auto it = pipeline->m_segmentInfo.find(2);
-  BOOST_REQUIRE(it != pipeline->m_segmentInfo.end());
-  BOOST_CHECK(it->second.state == SegmentState::FirstTimeSent);
+  auto segInfo = pipeline->m_segmentTable.find(2);
+  BOOST_REQUIRE(segInfo != nullptr);
+  BOOST_CHECK(segInfo->state == SegmentState::FirstTimeSent);
 
   // timeout segment 2 twice
   advanceClocks(time::milliseconds(400), 3);
@@ -511,20 +708,19 @@ BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
 
   // check if segment 2's state is Retransmitted
-  it = pipeline->m_segmentInfo.find(2);
-  BOOST_REQUIRE(it != pipeline->m_segmentInfo.end());
-  BOOST_CHECK(it->second.state == SegmentState::Retransmitted);
+  segInfo = pipeline->m_segmentTable.find(2);
+  BOOST_REQUIRE(segInfo != nullptr);
+  BOOST_CHECK(segInfo->state == SegmentState::Retransmitted);
 
   // check if segment 2 was retransmitted twice
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount.at(2), 2);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(2), 2);
 
   // receive segment 2 the first time
   face.receive(*makeDataWithSegment(2));
   advanceClocks(time::nanoseconds(1));
 
-  // check if segment 2 was erased from m_segmentInfo
-  it = pipeline->m_segmentInfo.find(2);
-  BOOST_CHECK(it == pipeline->m_segmentInfo.end());
+  // check if segment 2 was erased from m_segmentTable
+  BOOST_CHECK(pipeline->m_segmentTable.find(2) == nullptr);
 
   auto prevRtt = rttEstimator.getAvgRtt();
   auto prevRto = rttEstimator.getEstimatedRto();
@@ -534,8 +730,7 @@ BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
   advanceClocks(time::nanoseconds(1));
 
   // nothing changed
-  it = pipeline->m_segmentInfo.find(2);
-  BOOST_CHECK(it == pipeline->m_segmentInfo.end());
+  BOOST_CHECK(pipeline->m_segmentTable.find(2) == nullptr);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
   BOOST_CHECK_EQUAL(rttEstimator.getAvgRtt(), prevRtt);
   BOOST_CHECK_EQUAL(rttEstimator.getEstimatedRto(), prevRto);
@@ -593,6 +788,72 @@ BOOST_AUTO_TEST_CASE(Bug5202)
   BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 1);
 }
 
+BOOST_AUTO_TEST_CASE(Backpressure)
+{
+  opt.maxBufferSize = 2;
+  createPipeline();
+
+  size_t backlog = 0;
+  pipeline->setBacklogCallback([&backlog] { return backlog; });
+
+  nDataSegments = 10;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+
+  // the consumer's buffer is full, no new segments are requested
+  backlog = 2;
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 3, MARGIN);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(pipeline->m_isBackpressured, true);
+  BOOST_CHECK_EQUAL(pipeline->m_nBackpressureStalls, 1);
+
+  // segment 1 times out and is retransmitted regardless of backpressure
+  advanceClocks(time::milliseconds(10), 101);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 1);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName().at(-1).toSegment(), 1);
+
+  // the consumer drains its buffer and the pipeline resumes
+  backlog = 0;
+  pipeline->notifyBacklogReduced();
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName().at(-1).toSegment(), 2);
+  BOOST_CHECK_EQUAL(pipeline->m_isBackpressured, false);
+  BOOST_CHECK_EQUAL(pipeline->m_nBackpressureStalls, 1);
+  BOOST_CHECK_GE(pipeline->m_backpressureTime, time::seconds(1));
+}
+
+BOOST_AUTO_TEST_CASE(Pacing)
+{
+  opt.enablePacing = true;
+  createPipeline();
+
+  nDataSegments = 10;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  // no RTT sample yet, the initial window is sent at once
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(pipeline->getPacingRate(), 0.0);
+
+  advanceClocks(100_ms);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+
+  // cwnd = 3 over srtt = 100ms, i.e., one Interest every 33.3ms
+  BOOST_CHECK_CLOSE(pipeline->getPacingRate(), 30.0, 0.1);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
+
+  advanceClocks(30_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
+  advanceClocks(5_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+}
+
 BOOST_AUTO_TEST_CASE(PrintSummaryWithNoRttMeasurements)
 {
   // test the console ouptut when no RTT measurement is available,
@@ -617,6 +878,35 @@ BOOST_AUTO_TEST_CASE(PrintSummaryWithNoRttMeasurements)
   std::cerr.rdbuf(oldBuf); // reset
 }
 
+BOOST_AUTO_TEST_CASE(WriteReport)
+{
+  auto writeReport = [this] {
+    std::ostringstream os;
+    JsonWriter json(os);
+    json.beginObject();
+    pipeline->writeReport(json);
+    json.endObject();
+    return os.str();
+  };
+
+  BOOST_CHECK_NE(writeReport().find("\"rttMs\": null"), std::string::npos);
+
+  nDataSegments = 3;
+  run(name);
+  advanceClocks(50_ms);
+  for (uint64_t segNo = 0; segNo < nDataSegments; ++segNo) {
+    face.receive(*makeDataWithSegment(segNo));
+    advanceClocks(time::nanoseconds(1));
+  }
+
+  auto report = writeReport();
+  BOOST_CHECK_NE(report.find("\"segmentsReceived\": 3,"), std::string::npos);
+  BOOST_CHECK_NE(report.find("\"retransmissions\": 0,"), std::string::npos);
+  BOOST_CHECK_NE(report.find("\"ssthresh\": null,"), std::string::npos);
+  BOOST_CHECK_NE(report.find("\"samples\": 3,"), std::string::npos);
+  BOOST_CHECK_NE(report.find("\"p50\": "), std::string::npos);
+}
+
 BOOST_AUTO_TEST_CASE(StopsWhenFileSizeLessThanChunkSize)
 {
   // test to see if the program doesn't hang,
@@ -633,7 +923,7 @@ BOOST_AUTO_TEST_CASE(StopsWhenFileSizeLessThanChunkSize)
   advanceClocks(time::nanoseconds(1));
 
   BOOST_CHECK_EQUAL(pipeline->m_hasFinalBlockId, true);
-  BOOST_CHECK_EQUAL(pipeline->m_segmentInfo.size(), 0);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.size(), 0);
   BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
 }
 
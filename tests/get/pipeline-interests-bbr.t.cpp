@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tools/get/pipeline-interests-bbr.hpp"
+
+#include "pipeline-interests-fixture.hpp"
+
+namespace ndn::tests {
+
+class PipelineInterestBbrFixture : public PipelineInterestsFixture
+{
+protected:
+  PipelineInterestBbrFixture()
+  {
+    opt.isQuiet = true;
+    auto pline = std::make_unique<PipelineInterestsBbr>(face, rttEstimator, opt);
+    pipeline = pline.get();
+    setPipeline(std::move(pline));
+  }
+
+private:
+  static std::shared_ptr<RttEstimatorWithStats::Options>
+  makeRttEstimatorOptions()
+  {
+    auto rttOptions = std::make_shared<RttEstimatorWithStats::Options>();
+    rttOptions->alpha = 0.125;
+    rttOptions->beta = 0.25;
+    rttOptions->k = 8;
+    rttOptions->initialRto = 1_s;
+    rttOptions->minRto = 200_ms;
+    rttOptions->maxRto = 4_s;
+    rttOptions->rtoBackoffMultiplier = 2;
+    return rttOptions;
+  }
+
+protected:
+  Options opt;
+  RttEstimatorWithStats rttEstimator{makeRttEstimatorOptions()};
+  PipelineInterestsBbr* pipeline;
+};
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_FIXTURE_TEST_SUITE(TestPipelineInterestsBbr, PipelineInterestBbrFixture)
+
+BOOST_AUTO_TEST_CASE(Startup)
+{
+  nDataSegments = 10;
+  BOOST_CHECK_EQUAL(pipeline->m_mode, PipelineInterestsBbr::Mode::Startup);
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(pipeline->m_pacingRate, 0.0);
+
+  advanceClocks(10_ms);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+
+  // no bandwidth estimate yet, the window grows as in slow start
+  BOOST_CHECK_EQUAL(pipeline->m_cwnd, 3.0);
+  BOOST_CHECK(pipeline->m_minRtt >= 10_ms && pipeline->m_minRtt < 11_ms);
+  BOOST_CHECK_EQUAL(pipeline->m_btlBw, 0.0);
+
+  face.receive(*makeDataWithSegment(1));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_cwnd, 4.0);
+  BOOST_CHECK_GT(pipeline->m_pacingRate, 0.0);
+  BOOST_CHECK_EQUAL(pipeline->m_mode, PipelineInterestsBbr::Mode::Startup);
+}
+
+BOOST_AUTO_TEST_CASE(DeliveryRateSample)
+{
+  nDataSegments = 10;
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  advanceClocks(10_ms);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nDelivered, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_roundStartDelivered, 1);
+
+  // the sample taken at the end of the round includes the segment that ends it
+  advanceClocks(20_ms);
+  face.receive(*makeDataWithSegment(1));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nRounds, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_roundStartDelivered, 2);
+  BOOST_CHECK_CLOSE(pipeline->m_btlBw, 1.0 / 0.020, 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(ConstantBandwidth)
+{
+  nDataSegments = 1000;
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  // the bottleneck delivers one segment per millisecond
+  uint64_t nextSegNo = 0;
+  for (int i = 0; i < 200; ++i) {
+    advanceClocks(1_ms);
+    if (face.sentInterests.size() > nextSegNo) {
+      face.receive(*makeDataWithSegment(nextSegNo++));
+    }
+  }
+  advanceClocks(time::nanoseconds(1));
+
+  BOOST_CHECK(pipeline->m_isFullPipe);
+  BOOST_CHECK_EQUAL(pipeline->m_mode, PipelineInterestsBbr::Mode::ProbeBw);
+  BOOST_CHECK_CLOSE(pipeline->m_btlBw, 1000.0, 10.0);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(CongestionMarks)
+{
+  nDataSegments = 1000;
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  // same as ConstantBandwidth, but every Data packet is marked
+  uint64_t nextSegNo = 0;
+  for (int i = 0; i < 200; ++i) {
+    advanceClocks(1_ms);
+    if (face.sentInterests.size() > nextSegNo) {
+      face.receive(*makeDataWithSegmentAndCongMark(nextSegNo++));
+    }
+  }
+  advanceClocks(time::nanoseconds(1));
+
+  // the model is updated regardless of the marks
+  BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, static_cast<int64_t>(nextSegNo));
+  BOOST_CHECK_GT(pipeline->m_nRounds, 0);
+  BOOST_CHECK(pipeline->m_isFullPipe);
+  BOOST_CHECK_EQUAL(pipeline->m_mode, PipelineInterestsBbr::Mode::ProbeBw);
+  BOOST_CHECK_CLOSE(pipeline->m_btlBw, 1000.0, 10.0);
+  BOOST_CHECK_GE(pipeline->m_cwnd, PipelineInterestsBbr::MIN_CWND);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(LossDoesNotShrinkWindow)
+{
+  nDataSegments = 10;
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+
+  advanceClocks(1100_ms);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 2);
+  BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_cwnd, 2.0);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4); // both segments have been retransmitted
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPipelineInterestsBbr
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
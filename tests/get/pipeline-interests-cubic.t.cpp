@@ -94,6 +94,141 @@ BOOST_AUTO_TEST_CASE(SlowStart)
 }
 
 
+BOOST_AUTO_TEST_CASE(HystartDelayIncrease)
+{
+  nDataSegments = 200;
+  pipeline->m_cwnd = 20;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 20);
+
+  // first round: RTT = 10ms
+  advanceClocks(10_ms);
+  for (uint64_t i = 0; i < 20; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+  }
+  BOOST_CHECK_EQUAL(pipeline->m_hystartExit, PipelineInterestsCubic::HystartExit::NONE);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 40, MARGIN);
+
+  // second round: RTT = 30ms, slow start ends after enough samples have been collected
+  advanceClocks(30_ms);
+  for (uint64_t i = 20; i < 27; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+    BOOST_CHECK_EQUAL(pipeline->m_hystartExit, PipelineInterestsCubic::HystartExit::NONE);
+  }
+  face.receive(*makeDataWithSegment(27));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_hystartExit, PipelineInterestsCubic::HystartExit::DELAY_INCREASE);
+  BOOST_CHECK_CLOSE(pipeline->m_ssthresh, 48, MARGIN);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, pipeline->m_ssthresh, MARGIN);
+
+  // congestion avoidance from now on
+  double preCwnd = pipeline->m_cwnd;
+  face.receive(*makeDataWithSegment(28));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_LT(pipeline->m_cwnd - preCwnd, 1);
+}
+
+BOOST_AUTO_TEST_CASE(HystartStartsNewEpoch)
+{
+  nDataSegments = 200;
+  pipeline->m_cwnd = 20;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  advanceClocks(10_ms);
+  for (uint64_t i = 0; i < 20; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+  }
+  advanceClocks(30_ms);
+  for (uint64_t i = 20; i < 28; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+  }
+  BOOST_REQUIRE_EQUAL(pipeline->m_hystartExit, PipelineInterestsCubic::HystartExit::DELAY_INCREASE);
+
+  // the cubic epoch starts at the exit, from the current window
+  const double exitCwnd = pipeline->m_cwnd;
+  const auto exitTime = pipeline->m_lastDecrease;
+  BOOST_CHECK_CLOSE(pipeline->m_wmax, exitCwnd, MARGIN);
+  BOOST_CHECK_EQUAL(pipeline->m_k, 0.0);
+  BOOST_CHECK(time::steady_clock::now() - exitTime < 1_ms);
+
+  // the window approaches W_cubic(t) = C*t^3 + wmax from below, with shrinking increments
+  advanceClocks(100_ms);
+  const double t = (time::steady_clock::now() - exitTime).count() / 1e9;
+  const double target = 0.4 * t * t * t + exitCwnd;
+  double preCwnd = pipeline->m_cwnd;
+  double preIncrement = std::numeric_limits<double>::max();
+  for (uint64_t i = 28; i < 34; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+    double increment = pipeline->m_cwnd - preCwnd;
+    BOOST_CHECK_GT(increment, 0);
+    BOOST_CHECK_LT(increment, preIncrement);
+    BOOST_CHECK_LE(pipeline->m_cwnd, target);
+    preCwnd = pipeline->m_cwnd;
+    preIncrement = increment;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(HystartAckTrain)
+{
+  nDataSegments = 200;
+  pipeline->m_cwnd = 20;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  // first round: RTT = 10ms
+  advanceClocks(10_ms);
+  for (uint64_t i = 0; i < 20; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+  }
+
+  // second round: Data packets keep arriving every 0.6ms, the RTT does not increase
+  // significantly but the train exceeds half the min RTT after 9 intervals
+  advanceClocks(10_ms);
+  for (uint64_t i = 20; i < 29; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(600_us);
+    BOOST_CHECK_EQUAL(pipeline->m_hystartExit, PipelineInterestsCubic::HystartExit::NONE);
+  }
+  face.receive(*makeDataWithSegment(29));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_hystartExit, PipelineInterestsCubic::HystartExit::ACK_TRAIN);
+  BOOST_CHECK_CLOSE(pipeline->m_ssthresh, 50, MARGIN);
+}
+
+BOOST_AUTO_TEST_CASE(HystartDisabled)
+{
+  opt.disableHystart = true;
+  createPipeline();
+
+  nDataSegments = 200;
+  pipeline->m_cwnd = 20;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  advanceClocks(10_ms);
+  for (uint64_t i = 0; i < 20; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+  }
+  advanceClocks(30_ms);
+  for (uint64_t i = 20; i < 40; ++i) {
+    face.receive(*makeDataWithSegment(i));
+    advanceClocks(time::nanoseconds(1));
+  }
+
+  BOOST_CHECK_EQUAL(pipeline->m_hystartExit, PipelineInterestsCubic::HystartExit::NONE);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 60, MARGIN);
+  BOOST_CHECK_EQUAL(pipeline->m_ssthresh, std::numeric_limits<double>::max());
+}
+
 BOOST_AUTO_TEST_CASE(Timeout)
 {
   nDataSegments = 8;
@@ -152,7 +287,7 @@ BOOST_AUTO_TEST_CASE(Timeout)
   BOOST_CHECK_EQUAL(pipeline->m_nReceived, 6);
   BOOST_CHECK_CLOSE(pipeline->m_cwnd, 4.9, MARGIN); // congestion avoidance
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[3], 1);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(3), 1);
 
   BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 3);
   BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 3);
@@ -195,8 +330,8 @@ BOOST_AUTO_TEST_CASE(CongestionMarksWithCwa)
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
 
   // make sure no interest is retransmitted for marked data packets
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[5], 0);
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[nDataSegments - 1], 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 0);
 
   // check number of received marked data packets
   BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 2);
@@ -240,8 +375,8 @@ BOOST_AUTO_TEST_CASE(CongestionMarksWithoutCwa)
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
 
   // make sure no interest is retransmitted for marked data packets
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[5], 0);
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[nDataSegments - 1], 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 0);
 
   // check number of received marked data packets
   BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 2);
@@ -278,7 +413,8 @@ BOOST_AUTO_TEST_CASE(IgnoreCongestionMarks)
   BOOST_CHECK_EQUAL(pipeline->m_retxQueue.size(), 0);
 
   // make sure no interest is retransmitted for marked data packet
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[nDataSegments - 1], 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nRetransmitted, 0);
 
   // check number of received marked data packets
   BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 1);
@@ -316,7 +452,7 @@ BOOST_AUTO_TEST_CASE(Nack)
   advanceClocks(time::nanoseconds(1));
 
   // segment 2 is retransmitted
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[2], 1);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(2), 1);
 
   // receive a nack with NackReason::NONE for segment 3
   auto nack3 = makeNack(face.sentInterests[3], lp::NackReason::NONE);
@@ -436,7 +572,7 @@ BOOST_AUTO_TEST_CASE(SpuriousFailureBeforeFinalBlockIdReceived)
   advanceClocks(time::seconds(1));
 
   // segment 3 is retransmitted
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount[3], 1);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(3), 1);
 
   // receive segment 3
   face.receive(*makeDataWithSegment(3));
@@ -447,7 +583,7 @@ BOOST_AUTO_TEST_CASE(SpuriousFailureBeforeFinalBlockIdReceived)
 
 BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
 {
-  // test that m_segmentInfo is properly maintained when
+  // test that m_segmentTable is properly maintained when
   // a segment is received after two consecutive timeouts
 
   nDataSegments = 3;
@@ -466,9 +602,9 @@ BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
 
   // check if segment 2's state is FirstTimeSent
-  auto it = pipeline->m_segmentInfo.find(2);
-  BOOST_REQUIRE(it != pipeline->m_segmentInfo.end());
-  BOOST_CHECK(it->second.state == SegmentState::FirstTimeSent);
+  auto segInfo = pipeline->m_segmentTable.find(2);
+  BOOST_REQUIRE(segInfo != nullptr);
+  BOOST_CHECK(segInfo->state == SegmentState::FirstTimeSent);
 
   // timeout segment 2 twice
   advanceClocks(time::milliseconds(400), 3);
@@ -476,20 +612,19 @@ BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
 
   // check if segment 2's state is Retransmitted
-  it = pipeline->m_segmentInfo.find(2);
-  BOOST_REQUIRE(it != pipeline->m_segmentInfo.end());
-  BOOST_CHECK(it->second.state == SegmentState::Retransmitted);
+  segInfo = pipeline->m_segmentTable.find(2);
+  BOOST_REQUIRE(segInfo != nullptr);
+  BOOST_CHECK(segInfo->state == SegmentState::Retransmitted);
 
   // check if segment 2 was retransmitted twice
-  BOOST_CHECK_EQUAL(pipeline->m_retxCount.at(2), 2);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.getRetxCount(2), 2);
 
   // receive segment 2 the first time
   face.receive(*makeDataWithSegment(2));
   advanceClocks(time::nanoseconds(1));
 
-  // check if segment 2 was erased from m_segmentInfo
-  it = pipeline->m_segmentInfo.find(2);
-  BOOST_CHECK(it == pipeline->m_segmentInfo.end());
+  // check if segment 2 was erased from m_segmentTable
+  BOOST_CHECK(pipeline->m_segmentTable.find(2) == nullptr);
 
   auto prevRtt = rttEstimator.getAvgRtt();
   auto prevRto = rttEstimator.getEstimatedRto();
@@ -499,8 +634,7 @@ BOOST_AUTO_TEST_CASE(SegmentInfoMaintenance)
   advanceClocks(time::nanoseconds(1));
 
   // nothing changed
-  it = pipeline->m_segmentInfo.find(2);
-  BOOST_CHECK(it == pipeline->m_segmentInfo.end());
+  BOOST_CHECK(pipeline->m_segmentTable.find(2) == nullptr);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
   BOOST_CHECK_EQUAL(rttEstimator.getAvgRtt(), prevRtt);
   BOOST_CHECK_EQUAL(rttEstimator.getEstimatedRto(), prevRto);
@@ -546,7 +680,7 @@ BOOST_AUTO_TEST_CASE(StopsWhenFileSizeLessThanChunkSize)
   advanceClocks(time::nanoseconds(1));
 
   BOOST_CHECK_EQUAL(pipeline->m_hasFinalBlockId, true);
-  BOOST_CHECK_EQUAL(pipeline->m_segmentInfo.size(), 0);
+  BOOST_CHECK_EQUAL(pipeline->m_segmentTable.size(), 0);
   BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
 }
 
@@ -96,6 +96,147 @@ BOOST_AUTO_TEST_CASE(FullPipeline)
   BOOST_CHECK_EQUAL(hasFailed, true);
 }
 
+BOOST_AUTO_TEST_CASE(Resume)
+{
+  nDataSegments = 13;
+
+  // segments 0-3 and every even segment have been received in a previous run
+  pipeline->resumeFrom(nDataSegments - 1, [] (uint64_t segNo) { return segNo < 4 || segNo % 2 == 0; }, 8);
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  // only the missing segments are requested, even though the pipeline is not full
+  const std::vector<uint64_t> missing{5, 7, 9, 11};
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), missing.size());
+  for (size_t i = 0; i < missing.size(); ++i) {
+    BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests[i]), missing[i]);
+  }
+
+  for (uint64_t segNo : missing) {
+    face.receive(*makeDataWithSegment(segNo));
+    advanceClocks(time::nanoseconds(1));
+  }
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, missing.size());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), missing.size());
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(PrefetchedSegment)
+{
+  nDataSegments = 8;
+
+  // segment 0 was received during version discovery
+  pipeline->setPrefetchedSegment(makeDataWithSegment(0));
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_hasFinalBlockId, true);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), opt.maxPipelineSize);
+  for (size_t i = 0; i < face.sentInterests.size(); ++i) {
+    BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests[i]), i + 1);
+  }
+
+  for (uint64_t segNo = 1; segNo < nDataSegments; ++segNo) {
+    face.receive(*makeDataWithSegment(segNo));
+    advanceClocks(time::nanoseconds(1));
+  }
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, nDataSegments);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), nDataSegments - 1);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(Overshoot)
+{
+  nDataSegments = 3;
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), opt.maxPipelineSize);
+
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nOvershoot, opt.maxPipelineSize - nDataSegments);
+}
+
+BOOST_AUTO_TEST_CASE(ProbeFinalBlockId)
+{
+  opt.probeFinalBlockId = true;
+  createPipeline();
+  nDataSegments = 3;
+
+  // only the first segment is requested until the FinalBlockId is known
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), nDataSegments);
+  BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests.back()), nDataSegments - 1);
+
+  for (uint64_t segNo = 1; segNo < nDataSegments; ++segNo) {
+    face.receive(*makeDataWithSegment(segNo));
+    advanceClocks(time::nanoseconds(1));
+  }
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, nDataSegments);
+  BOOST_CHECK_EQUAL(pipeline->m_nOvershoot, 0);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(ProbeWithoutFinalBlockId)
+{
+  opt.probeFinalBlockId = true;
+  createPipeline();
+  nDataSegments = 13;
+
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+
+  // the number of segments that can be requested doubles with every segment received
+  // without a FinalBlockId
+  face.receive(*makeDataWithSegment(0, false));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+
+  face.receive(*makeDataWithSegment(1, false));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+
+  // once the FinalBlockId is known, the whole pipeline is used
+  face.receive(*makeDataWithSegment(2));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3 + opt.maxPipelineSize);
+  BOOST_CHECK_EQUAL(pipeline->m_nOvershoot, 0);
+}
+
+BOOST_AUTO_TEST_CASE(DestroyedWithPendingResume)
+{
+  opt.maxBufferSize = 1;
+  createPipeline();
+
+  size_t backlog = 0;
+  pipeline->setBacklogCallback([&backlog] { return backlog; });
+
+  nDataSegments = 13;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), opt.maxPipelineSize);
+
+  backlog = 1;
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_isBackpressured, true);
+
+  // the resumption is still queued when the pipeline is destroyed, it must not run
+  backlog = 0;
+  pipeline->notifyBacklogReduced();
+  BOOST_CHECK_EQUAL(pipeline->m_isResumePending, true);
+  setPipeline(nullptr);
+  pipeline = nullptr;
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), opt.maxPipelineSize);
+}
+
 BOOST_AUTO_TEST_CASE(TimeoutAllSegments)
 {
   nDataSegments = 13;
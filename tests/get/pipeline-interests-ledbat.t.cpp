@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tools/get/pipeline-interests-ledbat.hpp"
+
+#include "pipeline-interests-fixture.hpp"
+
+namespace ndn::tests {
+
+class PipelineInterestLedbatFixture : public PipelineInterestsFixture
+{
+protected:
+  PipelineInterestLedbatFixture()
+  {
+    opt.isQuiet = true;
+    opt.targetDelay = 50_ms;
+    auto pline = std::make_unique<PipelineInterestsLedbat>(face, rttEstimator, opt);
+    pipeline = pline.get();
+    setPipeline(std::move(pline));
+  }
+
+private:
+  static std::shared_ptr<RttEstimatorWithStats::Options>
+  makeRttEstimatorOptions()
+  {
+    auto rttOptions = std::make_shared<RttEstimatorWithStats::Options>();
+    rttOptions->alpha = 0.125;
+    rttOptions->beta = 0.25;
+    rttOptions->k = 4;
+    rttOptions->initialRto = 1_s;
+    rttOptions->minRto = 200_ms;
+    rttOptions->maxRto = 4_s;
+    rttOptions->rtoBackoffMultiplier = 2;
+    return rttOptions;
+  }
+
+protected:
+  Options opt;
+  RttEstimatorWithStats rttEstimator{makeRttEstimatorOptions()};
+  PipelineInterestsLedbat* pipeline;
+  static constexpr double MARGIN = 0.001;
+};
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_FIXTURE_TEST_SUITE(TestPipelineInterestsLedbat, PipelineInterestLedbatFixture)
+
+BOOST_AUTO_TEST_CASE(DelayBelowTarget)
+{
+  nDataSegments = 10;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+
+  advanceClocks(10_ms);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  // no delay sample yet, grow by 1/cwnd
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 2.5, MARGIN);
+
+  face.receive(*makeDataWithSegment(1));
+  advanceClocks(time::nanoseconds(1));
+  // no queueing delay
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 2.5 + 1 / 2.5, MARGIN);
+}
+
+BOOST_AUTO_TEST_CASE(DelayAboveTarget)
+{
+  nDataSegments = 10;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  advanceClocks(10_ms);
+  face.receive(*makeDataWithSegment(0));
+  face.receive(*makeDataWithSegment(1));
+  advanceClocks(time::nanoseconds(1));
+  double cwnd = pipeline->m_cwnd;
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+
+  // segments 2 and 3 experience 140ms of queueing delay
+  advanceClocks(150_ms);
+  face.receive(*makeDataWithSegment(2));
+  advanceClocks(time::nanoseconds(1));
+  // the latest sample when segment 2 arrived was still without queueing delay
+  BOOST_CHECK_GT(pipeline->m_cwnd, cwnd);
+  cwnd = pipeline->m_cwnd;
+
+  face.receive(*makeDataWithSegment(3));
+  advanceClocks(time::nanoseconds(1));
+  // off target by (50 - 140) / 50
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, cwnd - 1.8 / cwnd, 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(BaseDelayIncrease)
+{
+  BOOST_CHECK_EQUAL(pipeline->getBaseDelay(), time::nanoseconds::max());
+
+  pipeline->handleRttSample(20_ms);
+  advanceClocks(30_s);
+  pipeline->handleRttSample(10_ms);
+  BOOST_CHECK_EQUAL(pipeline->getBaseDelay(), 10_ms);
+  BOOST_CHECK_EQUAL(pipeline->m_baseDelays.size(), 1);
+
+  // the path changes, the RTT is now at least 60ms
+  for (int i = 0; i < 9; ++i) {
+    advanceClocks(1_min);
+    pipeline->handleRttSample(80_ms);
+    pipeline->handleRttSample(60_ms);
+  }
+  // the old minimum is still within the history
+  BOOST_CHECK_EQUAL(pipeline->m_baseDelays.size(), 10);
+  BOOST_CHECK_EQUAL(pipeline->getBaseDelay(), 10_ms);
+
+  advanceClocks(1_min);
+  pipeline->handleRttSample(70_ms);
+  BOOST_CHECK_EQUAL(pipeline->m_baseDelays.size(), 10);
+  BOOST_CHECK_EQUAL(pipeline->getBaseDelay(), 60_ms);
+}
+
+BOOST_AUTO_TEST_CASE(Loss)
+{
+  nDataSegments = 10;
+  pipeline->m_cwnd = 8.0;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 8);
+
+  // all Interests time out, but the window is halved only once
+  advanceClocks(1100_ms);
+  BOOST_CHECK_EQUAL(pipeline->m_nTimeouts, 8);
+  BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 1);
+  BOOST_CHECK_CLOSE(pipeline->m_cwnd, 4.0, MARGIN);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPipelineInterestsLedbat
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
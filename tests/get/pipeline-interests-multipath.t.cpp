@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "tools/get/pipeline-interests-multipath.hpp"
+#include "tools/get/pipeline-interests-aimd.hpp"
+
+#include "pipeline-interests-fixture.hpp"
+
+namespace ndn::tests {
+
+class PipelineInterestMultipathFixture : public PipelineInterestsFixture
+{
+protected:
+  PipelineInterestMultipathFixture()
+  {
+    opt.isQuiet = true;
+    opt.forwardingHint = {"/site-a", "/site-b"};
+    auto pline = std::make_unique<PipelineInterestsMultipath>(face, opt, nullptr,
+      [this] (RttEstimatorWithStats& rttEstimator, const Options& pathOpt) {
+        return std::make_unique<PipelineInterestsAimd>(face, rttEstimator, pathOpt);
+      });
+    pipeline = pline.get();
+    setPipeline(std::move(pline));
+  }
+
+  static Name
+  getPath(const Interest& interest)
+  {
+    BOOST_REQUIRE_EQUAL(interest.getForwardingHint().size(), 1);
+    return interest.getForwardingHint().front();
+  }
+
+protected:
+  Options opt;
+  PipelineInterestsMultipath* pipeline = nullptr;
+};
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_FIXTURE_TEST_SUITE(TestPipelineInterestsMultipath, PipelineInterestMultipathFixture)
+
+BOOST_AUTO_TEST_CASE(SharedSegments)
+{
+  nDataSegments = 8;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  // each path fills its own initial window, with a single delegation per Interest
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 4);
+  for (uint64_t i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests[i]), i);
+    BOOST_CHECK_EQUAL(getPath(face.sentInterests[i]), i < 2 ? "/site-a" : "/site-b");
+  }
+
+  for (size_t i = 0; i < face.sentInterests.size(); ++i) {
+    face.receive(*makeDataWithSegment(getSegmentFromPacket(face.sentInterests[i])));
+    advanceClocks(time::nanoseconds(1));
+  }
+
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), nDataSegments);
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, nDataSegments);
+  BOOST_CHECK_EQUAL(pipeline->m_paths[0].nReceived + pipeline->m_paths[1].nReceived, nDataSegments);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(LossRetriedOnOtherPath)
+{
+  nDataSegments = 4;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 4);
+
+  // segment 0 cannot be retrieved via /site-a
+  face.receive(makeNack(face.sentInterests[0], lp::NackReason::NO_ROUTE));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_queue.getNLost(), 1);
+
+  // it is retransmitted via /site-b as soon as that path has room in its window
+  face.receive(*makeDataWithSegment(2));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_queue.getNLost(), 0);
+  const Interest& retx = face.sentInterests.back();
+  BOOST_CHECK_EQUAL(getSegmentFromPacket(retx), 0);
+  BOOST_CHECK_EQUAL(getPath(retx), "/site-b");
+
+  for (uint64_t segNo : {0, 1, 3}) {
+    face.receive(*makeDataWithSegment(segNo));
+    advanceClocks(time::nanoseconds(1));
+  }
+
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, nDataSegments);
+  BOOST_CHECK_EQUAL(pipeline->m_paths[0].nReceived, 1);
+  BOOST_CHECK_EQUAL(pipeline->m_paths[1].nReceived, 3);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPipelineInterestsMultipath
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "tools/get/pipeline-interests-striped.hpp"
+#include "tools/get/pipeline-interests-aimd.hpp"
+
+#include "pipeline-interests-fixture.hpp"
+
+namespace ndn::tests {
+
+class PipelineInterestStripedFixture : public PipelineInterestsFixture
+{
+protected:
+  PipelineInterestStripedFixture()
+  {
+    opt.isQuiet = true;
+  }
+
+  void
+  createPipeline(size_t nStreams)
+  {
+    auto pline = std::make_unique<PipelineInterestsStriped>(face, opt, nStreams, nullptr,
+      [this] (RttEstimatorWithStats& rttEstimator, const Options& streamOpt) {
+        return std::make_unique<PipelineInterestsAimd>(face, rttEstimator, streamOpt);
+      });
+    pipeline = pline.get();
+    setPipeline(std::move(pline));
+  }
+
+protected:
+  Options opt;
+  PipelineInterestsStriped* pipeline = nullptr;
+};
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_FIXTURE_TEST_SUITE(TestPipelineInterestsStriped, PipelineInterestStripedFixture)
+
+BOOST_AUTO_TEST_CASE(Interleaved)
+{
+  nDataSegments = 8;
+  createPipeline(2);
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+
+  // each stream fills its own initial window with the segments of its stripe
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests[0]), 0);
+  BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests[1]), 2);
+  BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests[2]), 1);
+  BOOST_CHECK_EQUAL(getSegmentFromPacket(face.sentInterests[3]), 3);
+
+  for (size_t i = 0; i < face.sentInterests.size(); ++i) {
+    face.receive(*makeDataWithSegment(getSegmentFromPacket(face.sentInterests[i])));
+    advanceClocks(time::nanoseconds(1));
+  }
+
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), nDataSegments);
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, nDataSegments);
+  BOOST_CHECK_EQUAL(pipeline->m_streams[0].nReceived, 4);
+  BOOST_CHECK_EQUAL(pipeline->m_streams[1].nReceived, 4);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_CASE(LastSegmentSharedAmongStreams)
+{
+  nDataSegments = 2;
+  createPipeline(3);
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 6);
+
+  // the FinalBlockId carried by segment 0 stops the streams that only requested later segments
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_hasFinalBlockId, true);
+  for (const auto& stream : pipeline->m_streams) {
+    BOOST_CHECK_EQUAL(stream.pipeline->m_hasFinalBlockId, true);
+    BOOST_CHECK_EQUAL(stream.pipeline->m_lastSegmentNo, 1);
+  }
+  BOOST_CHECK(pipeline->m_streams[2].pipeline->m_segmentTable.empty());
+  BOOST_CHECK_EQUAL(pipeline->m_streams[1].pipeline->m_segmentTable.size(), 1);
+
+  face.receive(*makeDataWithSegment(1));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(pipeline->m_nReceived, 2);
+
+  // no segment is retransmitted after the transfer is complete
+  advanceClocks(1_s, 10);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 6);
+  BOOST_CHECK_EQUAL(hasFailed, false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPipelineInterestsStriped
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tools/get/reorder-buffer.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <vector>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_AUTO_TEST_SUITE(TestReorderBuffer)
+
+static std::shared_ptr<const Data>
+makeSegment(uint64_t segNo)
+{
+  return makeData(Name("/ndn/chunks/test").appendVersion(1).appendSegment(segNo));
+}
+
+static std::vector<uint64_t>
+drainAll(ReorderBuffer& buffer)
+{
+  std::vector<uint64_t> drained;
+  buffer.drain([&] (std::shared_ptr<const Data> data) {
+    drained.push_back(data->getName().at(-1).toSegment());
+  });
+  return drained;
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  ReorderBuffer buffer(5);
+  BOOST_CHECK_EQUAL(buffer.capacity(), 8);
+
+  buffer.reset(0);
+  BOOST_CHECK_EQUAL(buffer.capacity(), 1);
+
+  buffer.reset(64, 10);
+  BOOST_CHECK_EQUAL(buffer.capacity(), 64);
+  BOOST_CHECK_EQUAL(buffer.getNextSegmentNo(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(DrainContiguousRun)
+{
+  ReorderBuffer buffer(8);
+
+  BOOST_CHECK(buffer.insert(2, makeSegment(2)));
+  BOOST_CHECK(buffer.insert(1, makeSegment(1)));
+  BOOST_CHECK(buffer.insert(4, makeSegment(4)));
+  BOOST_CHECK_EQUAL(buffer.size(), 3);
+  BOOST_CHECK(drainAll(buffer).empty());
+
+  BOOST_CHECK(buffer.insert(0, makeSegment(0)));
+  BOOST_CHECK_EQUAL(buffer.getHighWaterMark(), 4);
+
+  std::vector<uint64_t> expected{0, 1, 2};
+  auto drained = drainAll(buffer);
+  BOOST_CHECK_EQUAL_COLLECTIONS(drained.begin(), drained.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(buffer.getNextSegmentNo(), 3);
+  BOOST_CHECK_EQUAL(buffer.size(), 1);
+
+  BOOST_CHECK(buffer.insert(3, makeSegment(3)));
+  expected = {3, 4};
+  drained = drainAll(buffer);
+  BOOST_CHECK_EQUAL_COLLECTIONS(drained.begin(), drained.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(buffer.size(), 0);
+  BOOST_CHECK_EQUAL(buffer.getHighWaterMark(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(Duplicates)
+{
+  ReorderBuffer buffer(4);
+
+  BOOST_CHECK(buffer.insert(1, makeSegment(1)));
+  BOOST_CHECK(!buffer.insert(1, makeSegment(1))); // already buffered
+  BOOST_CHECK_EQUAL(buffer.size(), 1);
+
+  BOOST_CHECK(buffer.insert(0, makeSegment(0)));
+  BOOST_CHECK_EQUAL(drainAll(buffer).size(), 2);
+
+  BOOST_CHECK(!buffer.insert(0, makeSegment(0))); // already drained
+  BOOST_CHECK_EQUAL(buffer.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(WrapAround)
+{
+  ReorderBuffer buffer(4);
+
+  for (uint64_t segNo = 0; segNo < 20; segNo += 2) {
+    BOOST_CHECK(buffer.insert(segNo + 1, makeSegment(segNo + 1)));
+    BOOST_CHECK(buffer.insert(segNo, makeSegment(segNo)));
+    BOOST_CHECK_EQUAL(drainAll(buffer).size(), 2);
+  }
+
+  BOOST_CHECK_EQUAL(buffer.capacity(), 4);
+  BOOST_CHECK_EQUAL(buffer.getNextSegmentNo(), 20);
+  BOOST_CHECK_EQUAL(buffer.getHighWaterMark(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Grow)
+{
+  ReorderBuffer buffer(4);
+
+  // move the head away from slot 0
+  BOOST_CHECK(buffer.insert(0, makeSegment(0)));
+  BOOST_CHECK(buffer.insert(1, makeSegment(1)));
+  BOOST_CHECK_EQUAL(drainAll(buffer).size(), 2);
+
+  BOOST_CHECK(buffer.insert(4, makeSegment(4)));
+  BOOST_CHECK(buffer.insert(3, makeSegment(3)));
+  BOOST_CHECK(buffer.insert(12, makeSegment(12))); // beyond the current window
+  BOOST_CHECK_EQUAL(buffer.capacity(), 16);
+  BOOST_CHECK_EQUAL(buffer.size(), 3);
+
+  BOOST_CHECK(buffer.insert(2, makeSegment(2)));
+  std::vector<uint64_t> expected{2, 3, 4};
+  auto drained = drainAll(buffer);
+  BOOST_CHECK_EQUAL_COLLECTIONS(drained.begin(), drained.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(buffer.getNextSegmentNo(), 5);
+  BOOST_CHECK_EQUAL(buffer.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestReorderBuffer
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
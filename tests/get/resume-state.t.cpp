@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tools/get/resume-state.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+class ResumeStateFixture
+{
+protected:
+  ~ResumeStateFixture()
+  {
+    std::filesystem::remove(path);
+  }
+
+protected:
+  const std::filesystem::path path = std::filesystem::temp_directory_path() / "ndnget-resume-state.t";
+  const Name versionedName = Name("/ndn/chunks/test").appendVersion(1);
+};
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_FIXTURE_TEST_SUITE(TestResumeState, ResumeStateFixture)
+
+BOOST_AUTO_TEST_CASE(NewFile)
+{
+  std::filesystem::remove(path);
+
+  ResumeState state(path.string());
+  BOOST_CHECK(!state.hasLayout());
+  BOOST_CHECK(state.getVersionedName().empty());
+  BOOST_CHECK(!state.isWritten(0));
+  BOOST_CHECK_EQUAL(state.getNWritten(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Reopen)
+{
+  std::filesystem::remove(path);
+  {
+    ResumeState state(path.string());
+    state.reset(versionedName);
+
+    // the layout is not known yet
+    state.markWritten(0);
+    BOOST_CHECK(!state.isWritten(0));
+    BOOST_CHECK_EQUAL(state.getNWritten(), 0);
+
+    state.setLayout(20, 4096);
+    BOOST_CHECK(state.hasLayout());
+    BOOST_CHECK(state.isWritten(0));
+    state.markWritten(9);
+    state.markWritten(9);
+    state.markWritten(20);
+    state.markWritten(21); // beyond the last segment, ignored
+    BOOST_CHECK_EQUAL(state.getNWritten(), 3);
+  }
+
+  ResumeState state(path.string());
+  BOOST_CHECK(state.hasLayout());
+  BOOST_CHECK_EQUAL(state.getVersionedName(), versionedName);
+  BOOST_CHECK_EQUAL(state.getLastSegmentNo(), 20);
+  BOOST_CHECK_EQUAL(state.getSegmentSize(), 4096);
+  BOOST_CHECK_EQUAL(state.getNWritten(), 3);
+  for (uint64_t segNo = 0; segNo <= 21; ++segNo) {
+    BOOST_CHECK_EQUAL(state.isWritten(segNo), segNo == 0 || segNo == 9 || segNo == 20);
+  }
+
+  // start over with another version
+  state.reset(Name("/ndn/chunks/test").appendVersion(2));
+  BOOST_CHECK(!state.hasLayout());
+  BOOST_CHECK(!state.isWritten(0));
+  BOOST_CHECK_EQUAL(state.getNWritten(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(NoLayout)
+{
+  std::filesystem::remove(path);
+  {
+    ResumeState state(path.string());
+    state.reset(versionedName);
+    state.markWritten(0);
+  }
+
+  // the segments written before the layout was known are lost
+  ResumeState state(path.string());
+  BOOST_CHECK(!state.hasLayout());
+  BOOST_CHECK_EQUAL(state.getVersionedName(), versionedName);
+  BOOST_CHECK_EQUAL(state.getNWritten(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  {
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    os << "this is not a state file, but it is long enough to contain a header";
+  }
+  BOOST_CHECK_THROW(ResumeState(path.string()), ResumeState::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestResumeState
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
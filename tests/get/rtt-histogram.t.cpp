@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "tools/get/rtt-histogram.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_AUTO_TEST_SUITE(TestRttHistogram)
+
+BOOST_AUTO_TEST_CASE(Percentiles)
+{
+  RttHistogram histogram;
+  BOOST_CHECK_EQUAL(histogram.getNSamples(), 0);
+
+  for (int i = 100; i >= 1; --i) {
+    histogram.add(time::milliseconds(i));
+  }
+  BOOST_CHECK_EQUAL(histogram.getNSamples(), 100);
+
+  // every percentile is within 0.5% of the exact value
+  BOOST_CHECK_CLOSE(histogram.getPercentile(0.0).count() / 1e6, 1.0, 0.5);
+  BOOST_CHECK_CLOSE(histogram.getPercentile(0.5).count() / 1e6, 50.0, 0.5);
+  BOOST_CHECK_CLOSE(histogram.getPercentile(0.9).count() / 1e6, 90.0, 0.5);
+  BOOST_CHECK_CLOSE(histogram.getPercentile(0.99).count() / 1e6, 99.0, 0.5);
+  BOOST_CHECK_CLOSE(histogram.getPercentile(1.0).count() / 1e6, 100.0, 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(OutOfRange)
+{
+  RttHistogram histogram;
+  histogram.add(10_ns);
+  histogram.add(2_h);
+
+  // clamped to the first and last buckets
+  BOOST_CHECK_LT(histogram.getPercentile(0.0), 2_us);
+  BOOST_CHECK_GT(histogram.getPercentile(1.0), 10_min);
+  BOOST_CHECK_LT(histogram.getPercentile(1.0), 2_h);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestRttHistogram
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tools/get/segment-table.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <chrono>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_AUTO_TEST_SUITE(TestSegmentTable)
+
+BOOST_AUTO_TEST_CASE(InsertFindErase)
+{
+  SegmentTable table(4);
+  BOOST_CHECK_EQUAL(table.capacity(), 4);
+  BOOST_CHECK(table.empty());
+
+  table.insert(1).retxCount = 2;
+  table.insert(2).state = SegmentState::Retransmitted;
+  BOOST_CHECK_EQUAL(table.size(), 2);
+
+  // inserting an existing segment returns the same record
+  BOOST_CHECK_EQUAL(table.insert(1).retxCount, 2);
+  BOOST_CHECK_EQUAL(table.size(), 2);
+
+  BOOST_REQUIRE(table.find(2) != nullptr);
+  BOOST_CHECK_EQUAL(table.find(2)->state, SegmentState::Retransmitted);
+  BOOST_CHECK(table.find(5) == nullptr); // same slot as segment 1
+  BOOST_CHECK_EQUAL(table.getRetxCount(1), 2);
+  BOOST_CHECK_EQUAL(table.getRetxCount(3), 0);
+
+  BOOST_CHECK(table.erase(1));
+  BOOST_CHECK(!table.erase(1));
+  BOOST_CHECK(table.find(1) == nullptr);
+  BOOST_CHECK_EQUAL(table.size(), 1);
+
+  table.clear();
+  BOOST_CHECK(table.empty());
+  BOOST_CHECK(table.find(2) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(SlidingWindow)
+{
+  SegmentTable table(4);
+
+  // a window of 3 segments slides over 100 segments without growing the table
+  for (uint64_t segNo = 0; segNo < 100; ++segNo) {
+    if (segNo >= 3) {
+      BOOST_CHECK(table.erase(segNo - 3));
+    }
+    table.insert(segNo).retxCount = static_cast<int>(segNo);
+  }
+
+  BOOST_CHECK_EQUAL(table.capacity(), 4);
+  BOOST_CHECK_EQUAL(table.size(), 3);
+  BOOST_CHECK_EQUAL(table.getRetxCount(99), 99);
+}
+
+BOOST_AUTO_TEST_CASE(SparseSegments)
+{
+  SegmentTable table(4);
+
+  // segments far apart share the slot of segment 1, the table does not grow
+  table.insert(1).retxCount = 1;
+  table.insert(5).retxCount = 5;
+  table.insert(1000001).retxCount = 1000001;
+  BOOST_CHECK_EQUAL(table.capacity(), 4);
+  BOOST_CHECK_EQUAL(table.size(), 3);
+  BOOST_CHECK(table.find(9) == nullptr);
+
+  for (uint64_t segNo : {1, 5, 1000001}) {
+    BOOST_REQUIRE(table.find(segNo) != nullptr);
+    BOOST_CHECK_EQUAL(table.getRetxCount(segNo), static_cast<int>(segNo));
+  }
+
+  // the segments stored after the slot of an erased one can still be found
+  BOOST_CHECK(table.erase(1));
+  BOOST_CHECK_EQUAL(table.getRetxCount(5), 5);
+  BOOST_CHECK_EQUAL(table.getRetxCount(1000001), 1000001);
+  BOOST_CHECK(table.erase(5));
+  BOOST_CHECK_EQUAL(table.getRetxCount(1000001), 1000001);
+  BOOST_CHECK_EQUAL(table.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Grow)
+{
+  SegmentTable table(4);
+
+  for (uint64_t segNo : {3, 5, 13}) {
+    table.insert(segNo).retxCount = static_cast<int>(segNo);
+  }
+  BOOST_CHECK_EQUAL(table.capacity(), 4);
+
+  // the table would be more than 3/4 full
+  table.insert(1 << 30).retxCount = 1 << 30;
+  BOOST_CHECK_EQUAL(table.capacity(), 8);
+  BOOST_CHECK_EQUAL(table.size(), 4);
+
+  for (uint64_t segNo : {3, 5, 13, 1 << 30}) {
+    BOOST_REQUIRE(table.find(segNo) != nullptr);
+    BOOST_CHECK_EQUAL(table.getRetxCount(segNo), static_cast<int>(segNo));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SlidingWindowWithOldSegment)
+{
+  SegmentTable table;
+  auto start = std::chrono::steady_clock::now();
+
+  // a segment that keeps being retransmitted stays in the table while a window of 1000 segments
+  // slides over 10^6 segments: the table is sized to the window, not to the range of numbers
+  table.insert(0).retxCount = 7;
+  for (uint64_t segNo = 1; segNo < 1000000; ++segNo) {
+    if (segNo > 1000) {
+      table.erase(segNo - 1000);
+    }
+    table.insert(segNo);
+    BOOST_REQUIRE(table.find(segNo) != nullptr);
+  }
+
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  BOOST_CHECK_EQUAL(table.size(), 1001);
+  BOOST_CHECK_LE(table.capacity(), 2048);
+  BOOST_CHECK_EQUAL(table.getRetxCount(0), 7);
+  // a generous bound, the loop takes a few tens of milliseconds
+  BOOST_CHECK_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(Stride)
+{
+  SegmentTable table(4);
+  table.setStride(3);
+
+  // a window of 3 segments of stripe 1 (1, 4, 7, ...) slides without growing the table
+  for (uint64_t segNo = 1; segNo < 100; segNo += 3) {
+    if (segNo >= 10) {
+      BOOST_CHECK(table.erase(segNo - 9));
+    }
+    table.insert(segNo).retxCount = static_cast<int>(segNo);
+  }
+
+  BOOST_CHECK_EQUAL(table.capacity(), 4);
+  BOOST_CHECK_EQUAL(table.size(), 3);
+  BOOST_CHECK_EQUAL(table.getRetxCount(97), 97);
+  BOOST_CHECK(table.find(88) == nullptr);
+
+  table.insert(103); // the table would be more than 3/4 full
+  BOOST_CHECK_EQUAL(table.capacity(), 8);
+  for (uint64_t segNo : {91, 94, 97}) {
+    BOOST_CHECK_EQUAL(table.getRetxCount(segNo), static_cast<int>(segNo));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EraseGreaterThan)
+{
+  SegmentTable table(8);
+  for (uint64_t segNo = 10; segNo < 16; ++segNo) {
+    table.insert(segNo);
+  }
+
+  BOOST_CHECK_EQUAL(table.eraseGreaterThan(12), 3);
+  BOOST_CHECK_EQUAL(table.size(), 3);
+  BOOST_CHECK(table.find(12) != nullptr);
+  BOOST_CHECK(table.find(13) == nullptr);
+  BOOST_CHECK_EQUAL(table.eraseGreaterThan(12), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSegmentTable
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "tools/get/statistics-sampler.hpp"
+#include "tools/get/pipeline-interests-aimd.hpp"
+
+#include "pipeline-interests-fixture.hpp"
+
+#include <sstream>
+
+namespace ndn::tests {
+
+class StatisticsSamplerFixture : public PipelineInterestsFixture
+{
+protected:
+  StatisticsSamplerFixture()
+  {
+    opt.isQuiet = true;
+    auto pline = std::make_unique<PipelineInterestsAimd>(face, rttEstimator, opt);
+    pipeline = pline.get();
+    setPipeline(std::move(pline));
+  }
+
+  /**
+   * @brief Return the rows written so far, each split into its columns
+   */
+  std::vector<std::vector<std::string>>
+  getRows() const
+  {
+    std::vector<std::vector<std::string>> rows;
+    std::istringstream is(os.str());
+    std::string line;
+    while (std::getline(is, line)) {
+      std::vector<std::string> columns;
+      std::istringstream ls(line);
+      std::string column;
+      while (std::getline(ls, column, '\t')) {
+        columns.push_back(column);
+      }
+      rows.push_back(std::move(columns));
+    }
+    return rows;
+  }
+
+protected:
+  Options opt;
+  RttEstimatorWithStats rttEstimator{std::make_shared<RttEstimatorWithStats::Options>()};
+  PipelineInterestsAdaptive* pipeline;
+  std::ostringstream os;
+};
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_FIXTURE_TEST_SUITE(TestStatisticsSampler, StatisticsSamplerFixture)
+
+BOOST_AUTO_TEST_CASE(OneRowPerInterval)
+{
+  StatisticsSampler sampler(face, *pipeline, 100_ms, os, [] { return 7; });
+
+  nDataSegments = 3;
+  run(name);
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+
+  advanceClocks(50_ms);
+  face.receive(*makeDataWithSegment(0));
+  advanceClocks(time::nanoseconds(1));
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 3);
+
+  // only the header has been written so far
+  BOOST_CHECK_EQUAL(getRows().size(), 1);
+  advanceClocks(50_ms);
+  auto rows = getRows();
+  BOOST_REQUIRE_EQUAL(rows.size(), 2);
+  BOOST_CHECK_EQUAL(rows[0].size(), 13);
+  BOOST_CHECK_EQUAL(rows[0][0], "time");
+
+  const auto& row = rows[1];
+  BOOST_REQUIRE_EQUAL(row.size(), 13);
+  BOOST_CHECK_CLOSE(std::stod(row[0]), 0.1, 0.001);
+  BOOST_CHECK_EQUAL(row[2], "3"); // interests
+  BOOST_CHECK_EQUAL(row[3], "0"); // retx
+  BOOST_CHECK_EQUAL(row[4], "0"); // marks
+  BOOST_CHECK_EQUAL(row[5], "2"); // cwndmin
+  BOOST_CHECK_CLOSE(std::stod(row[6]), 2.5, 0.01); // cwndavg, 2 then 3 for half of the interval each
+  BOOST_CHECK_EQUAL(row[7], "3"); // cwndmax
+  BOOST_CHECK_EQUAL(row[8], "2"); // inflight
+  BOOST_CHECK_CLOSE(std::stod(row[9]), 50.0, 0.5); // rttp50
+  BOOST_CHECK_EQUAL(row[12], "7"); // backlog
+
+  // the last row is written when the transfer completes
+  face.receive(*makeDataWithSegment(1));
+  face.receive(*makeDataWithSegment(2));
+  advanceClocks(time::nanoseconds(1));
+  rows = getRows();
+  BOOST_REQUIRE_EQUAL(rows.size(), 3);
+  BOOST_CHECK_EQUAL(rows[2][2], "0"); // interests
+  BOOST_CHECK_EQUAL(rows[2][8], "0"); // inflight
+
+  // no more rows after the pipeline has stopped
+  advanceClocks(1_s);
+  BOOST_CHECK_EQUAL(getRows().size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(NoRttSamples)
+{
+  StatisticsSampler sampler(face, *pipeline, 100_ms, os);
+
+  nDataSegments = 3;
+  run(name);
+  advanceClocks(100_ms);
+
+  auto rows = getRows();
+  BOOST_REQUIRE_EQUAL(rows.size(), 2);
+  BOOST_REQUIRE_EQUAL(rows[1].size(), 13);
+  BOOST_CHECK_EQUAL(rows[1][9], "nan");
+  BOOST_CHECK_EQUAL(rows[1][12], "0"); // no backlog callback
+}
+
+BOOST_AUTO_TEST_CASE(PipelineDestroyed)
+{
+  bool isBacklogQueried = false;
+  StatisticsSampler sampler(face, *pipeline, 100_ms, os, [&] {
+    isBacklogQueried = true;
+    return 0;
+  });
+
+  nDataSegments = 3;
+  run(name);
+  advanceClocks(50_ms);
+
+  // destroying the pipeline, e.g., together with the consumer that owns it,
+  // does not write a last row, which would query the backlog of that consumer
+  setPipeline(nullptr);
+  pipeline = nullptr;
+  BOOST_CHECK_EQUAL(isBacklogQueried, false);
+  BOOST_CHECK_EQUAL(getRows().size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestStatisticsSampler
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
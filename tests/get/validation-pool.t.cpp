@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tools/get/validation-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/security/certificate-fetcher-offline.hpp>
+#include <ndn-cxx/security/validation-policy.hpp>
+#include <ndn-cxx/security/validator-null.hpp>
+
+#include <set>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_AUTO_TEST_SUITE(TestValidationPool)
+
+class RejectEvenSegmentsPolicy : public security::ValidationPolicy
+{
+public:
+  void
+  checkPolicy(const Data& data, const std::shared_ptr<security::ValidationState>& state,
+              const ValidationContinuation& continueValidation) final
+  {
+    if (data.getName().at(-1).toSegment() % 2 == 0) {
+      state->fail({security::ValidationError::POLICY_ERROR, "even segment"});
+    }
+    else {
+      continueValidation(nullptr, state);
+    }
+  }
+
+  void
+  checkPolicy(const Interest&, const std::shared_ptr<security::ValidationState>& state,
+              const ValidationContinuation& continueValidation) final
+  {
+    continueValidation(nullptr, state);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(AcceptAll)
+{
+  boost::asio::io_context io;
+  ValidationPool pool(io, 3, [] { return std::make_unique<security::ValidatorNull>(); });
+  BOOST_CHECK_EQUAL(pool.getNThreads(), 3);
+
+  std::set<uint64_t> validated;
+  for (uint64_t segNo = 0; segNo < 20; ++segNo) {
+    auto data = makeData(Name("/ndn/chunks/test").appendVersion(1).appendSegment(segNo));
+    pool.validate(data,
+      [&] (std::shared_ptr<const Data> data) { validated.insert(data->getName().at(-1).toSegment()); },
+      [] (auto&&...) { BOOST_ERROR("unexpected validation failure"); });
+  }
+  BOOST_CHECK_EQUAL(pool.getNOutstanding(), 20);
+  BOOST_CHECK(validated.empty()); // verdicts are only delivered on the I/O thread
+
+  io.run(); // returns once all verdicts have been delivered
+  BOOST_CHECK_EQUAL(validated.size(), 20);
+  BOOST_CHECK_EQUAL(pool.getNOutstanding(), 0);
+  BOOST_CHECK_EQUAL(pool.m_nValidated, 20);
+  BOOST_CHECK_EQUAL(pool.m_maxOutstanding, 20);
+}
+
+BOOST_AUTO_TEST_CASE(Failure)
+{
+  boost::asio::io_context io;
+  ValidationPool pool(io, 2, [] {
+    return std::make_unique<security::Validator>(std::make_unique<RejectEvenSegmentsPolicy>(),
+                                                 std::make_unique<security::CertificateFetcherOffline>());
+  });
+
+  size_t nSuccess = 0;
+  size_t nFailure = 0;
+  for (uint64_t segNo = 0; segNo < 10; ++segNo) {
+    auto data = makeData(Name("/ndn/chunks/test").appendVersion(1).appendSegment(segNo));
+    pool.validate(data,
+      [&] (auto&&) { ++nSuccess; },
+      [&] (std::shared_ptr<const Data> data, const security::ValidationError& error) {
+        BOOST_CHECK_EQUAL(data->getName().at(-1).toSegment() % 2, 0);
+        BOOST_CHECK_EQUAL(error.getCode(), security::ValidationError::POLICY_ERROR);
+        ++nFailure;
+      });
+  }
+
+  io.run();
+  BOOST_CHECK_EQUAL(nSuccess, 5);
+  BOOST_CHECK_EQUAL(nFailure, 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestValidationPool
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tools/get/vectored-writer.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <unistd.h>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+BOOST_AUTO_TEST_SUITE(Get)
+
+class VectoredWriterFixture
+{
+protected:
+  VectoredWriterFixture()
+  {
+    BOOST_REQUIRE_EQUAL(::pipe(fds), 0);
+  }
+
+  ~VectoredWriterFixture()
+  {
+    ::close(fds[0]);
+    ::close(fds[1]);
+  }
+
+  static std::shared_ptr<Data>
+  makeSegment(uint64_t segNo, const std::string& content)
+  {
+    auto data = makeData(Name("/ndn/chunks/test").appendVersion(1).appendSegment(segNo));
+    data->setContent(make_span(reinterpret_cast<const uint8_t*>(content.data()), content.size()));
+    return data;
+  }
+
+  std::string
+  readAll(size_t size)
+  {
+    std::string buf(size, '\0');
+    size_t nRead = 0;
+    while (nRead < size) {
+      ssize_t n = ::read(fds[0], buf.data() + nRead, size - nRead);
+      BOOST_REQUIRE_GT(n, 0);
+      nRead += static_cast<size_t>(n);
+    }
+    return buf;
+  }
+
+protected:
+  int fds[2];
+  boost::asio::io_context io;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestVectoredWriter, VectoredWriterFixture)
+
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  VectoredWriter writer(fds[1], io);
+
+  writer.append(makeSegment(0, "Lorem ipsum "));
+  writer.append(makeSegment(1, ""));
+  writer.append(makeSegment(2, "dolor sit amet"));
+  BOOST_CHECK_EQUAL(writer.getNWriteCalls(), 0);
+
+  writer.flush();
+  BOOST_CHECK_EQUAL(writer.getNWriteCalls(), 1);
+  BOOST_CHECK_EQUAL(writer.getNBytesWritten(), 26);
+  BOOST_CHECK_EQUAL(readAll(26), "Lorem ipsum dolor sit amet");
+
+  writer.flush(); // nothing to write
+  BOOST_CHECK_EQUAL(writer.getNWriteCalls(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ManySegments)
+{
+  VectoredWriter writer(fds[1], io);
+
+  // more buffers than can be passed to a single writev call
+  std::string expected;
+  for (uint64_t i = 0; i < 3000; ++i) {
+    std::string content(1, static_cast<char>('a' + i % 26));
+    writer.append(makeSegment(i, content));
+    expected += content;
+  }
+
+  writer.flush();
+  BOOST_CHECK_GE(writer.getNWriteCalls(), 2);
+  BOOST_CHECK_EQUAL(writer.getNBytesWritten(), expected.size());
+  BOOST_CHECK_EQUAL(readAll(expected.size()), expected);
+}
+
+BOOST_AUTO_TEST_CASE(RequestFlush)
+{
+  VectoredWriter writer(fds[1], io, 32);
+
+  // small writes are deferred until the ready handlers have run, and written together
+  writer.append(makeSegment(0, "Lorem ipsum "));
+  writer.requestFlush();
+  writer.append(makeSegment(1, "dolor sit amet"));
+  writer.requestFlush();
+  BOOST_CHECK_EQUAL(writer.getNWriteCalls(), 0);
+  BOOST_CHECK_EQUAL(writer.getNPendingBytes(), 26);
+
+  io.poll();
+  BOOST_CHECK_EQUAL(writer.getNWriteCalls(), 1);
+  BOOST_CHECK_EQUAL(writer.getNPendingBytes(), 0);
+  BOOST_CHECK_EQUAL(readAll(26), "Lorem ipsum dolor sit amet");
+
+  // the content is written right away once the threshold is reached
+  writer.append(makeSegment(2, "consectetuer "));
+  writer.requestFlush();
+  writer.append(makeSegment(3, "adipiscing elit. "));
+  writer.requestFlush();
+  writer.append(makeSegment(4, "Aenean commodo"));
+  writer.requestFlush();
+  BOOST_CHECK_EQUAL(writer.getNWriteCalls(), 2);
+  BOOST_CHECK_EQUAL(writer.getNPendingBytes(), 0);
+  BOOST_CHECK_EQUAL(readAll(44), "consectetuer adipiscing elit. Aenean commodo");
+
+  // a deferred flush does nothing once the content has been written
+  io.poll();
+  BOOST_CHECK_EQUAL(writer.getNWriteCalls(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestVectoredWriter
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
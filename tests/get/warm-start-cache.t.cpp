@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "tools/get/warm-start-cache.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace ndn::tests {
+
+using namespace ndn::get;
+
+class WarmStartCacheFixture
+{
+protected:
+  ~WarmStartCacheFixture()
+  {
+    std::filesystem::remove(path);
+  }
+
+  WarmStartCache::Entry
+  makeEntry(time::nanoseconds age, double cwnd = 40.0) const
+  {
+    return {time::system_clock::now() - age, 20_ms, 5_ms, cwnd, 30.0};
+  }
+
+protected:
+  const std::filesystem::path path = std::filesystem::temp_directory_path() / "ndnget-warm-start-cache.t";
+};
+
+BOOST_AUTO_TEST_SUITE(Get)
+BOOST_FIXTURE_TEST_SUITE(TestWarmStartCache, WarmStartCacheFixture)
+
+BOOST_AUTO_TEST_CASE(RoutablePrefix)
+{
+  BOOST_CHECK_EQUAL(WarmStartCache::getRoutablePrefix("/producer/object"), "/producer");
+  BOOST_CHECK_EQUAL(WarmStartCache::getRoutablePrefix(Name("/producer/object").appendVersion(1).appendSegment(0)),
+                    "/producer");
+  BOOST_CHECK_EQUAL(WarmStartCache::getRoutablePrefix("/object"), "/object");
+  BOOST_CHECK_EQUAL(WarmStartCache::getRoutablePrefix("/producer/object", {"/site-a"}), "/site-a");
+}
+
+BOOST_AUTO_TEST_CASE(SaveAndLoad)
+{
+  std::filesystem::remove(path);
+  {
+    WarmStartCache cache(path.string());
+    BOOST_CHECK(cache.m_entries.empty());
+    cache.insert("/producer", makeEntry(10_s));
+    cache.insert("/other", makeEntry(10_s, 8.0));
+    cache.save(1_h);
+  }
+
+  WarmStartCache cache(path.string());
+  BOOST_REQUIRE_EQUAL(cache.m_entries.size(), 2);
+  const auto* entry = cache.find("/producer", 1_h);
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_CHECK_EQUAL(entry->sRtt, 20_ms);
+  BOOST_CHECK_EQUAL(entry->rttVar, 5_ms);
+  BOOST_CHECK_EQUAL(entry->cwnd, 40.0);
+  BOOST_CHECK_EQUAL(entry->ssthresh, 30.0);
+  BOOST_CHECK_LT(time::system_clock::now() - entry->timestamp, 11_s);
+
+  entry = cache.find("/other", 1_h);
+  BOOST_REQUIRE(entry != nullptr);
+  BOOST_CHECK_EQUAL(entry->cwnd, 8.0);
+}
+
+BOOST_AUTO_TEST_CASE(LongestPrefixMatch)
+{
+  std::filesystem::remove(path);
+  WarmStartCache cache(path.string());
+  cache.insert("/producer", makeEntry(10_s, 10.0));
+  cache.insert("/producer/site", makeEntry(10_s, 20.0));
+
+  BOOST_CHECK(cache.find("/other", 1_h) == nullptr);
+  BOOST_REQUIRE(cache.find("/producer/other", 1_h) != nullptr);
+  BOOST_CHECK_EQUAL(cache.find("/producer/other", 1_h)->cwnd, 10.0);
+  BOOST_REQUIRE(cache.find("/producer/site/sub", 1_h) != nullptr);
+  BOOST_CHECK_EQUAL(cache.find("/producer/site/sub", 1_h)->cwnd, 20.0);
+}
+
+BOOST_AUTO_TEST_CASE(Aging)
+{
+  std::filesystem::remove(path);
+  {
+    WarmStartCache cache(path.string());
+    cache.insert("/producer", makeEntry(10_s, 10.0));
+    cache.insert("/producer/site", makeEntry(2_h, 20.0));
+
+    // the stale entry is ignored in favor of the shorter prefix
+    BOOST_REQUIRE(cache.find("/producer/site", 1_h) != nullptr);
+    BOOST_CHECK_EQUAL(cache.find("/producer/site", 1_h)->cwnd, 10.0);
+    BOOST_CHECK(cache.find("/producer", 5_s) == nullptr);
+    cache.save(1_h);
+  }
+
+  // and dropped from the file
+  WarmStartCache cache(path.string());
+  BOOST_CHECK_EQUAL(cache.m_entries.size(), 1);
+  BOOST_CHECK_EQUAL(cache.m_entries.count("/producer"), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  {
+    std::ofstream os(path);
+    os << "# comment\n"
+       << "/producer 1700000000000 20000 5000 40\n"
+       << "/producer 1700000000000 20000 5000 0 30\n";
+  }
+  {
+    WarmStartCache cache(path.string());
+    BOOST_CHECK_EQUAL(cache.m_entries.size(), 0);
+    BOOST_CHECK_EQUAL(cache.getNSkippedLines(), 2);
+  }
+
+  {
+    std::ofstream os(path);
+    os << "\n/producer 1700000000000 20000 5000 40 30\n";
+  }
+  WarmStartCache cache(path.string());
+  BOOST_CHECK_EQUAL(cache.m_entries.size(), 1);
+  BOOST_CHECK_EQUAL(cache.getNSkippedLines(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CorruptFile)
+{
+  // e.g., a file truncated or overwritten with garbage
+  {
+    std::ofstream os(path, std::ios::binary);
+    os << "/producer 1700000000000 20000 5000 40 30\n"
+       << "/other 17000000\x01\xfe\xff garbage\n"
+       << "/other/x 1700000000000 abc 5000 40 30\n"
+       << std::string(100, '\0') << "\n"
+       << "/last 1700000000000 20000 5000 40 30 extra\n"
+       << "/truncated 17000";
+  }
+  WarmStartCache cache(path.string());
+  BOOST_CHECK_EQUAL(cache.getNSkippedLines(), 5);
+  BOOST_REQUIRE_EQUAL(cache.m_entries.size(), 1);
+  BOOST_CHECK_EQUAL(cache.m_entries.count("/producer"), 1);
+
+  // saving the cache drops the corrupt lines
+  cache.insert("/new", makeEntry(10_s));
+  cache.save(100000_h);
+  WarmStartCache reloaded(path.string());
+  BOOST_CHECK_EQUAL(reloaded.getNSkippedLines(), 0);
+  BOOST_CHECK_EQUAL(reloaded.m_entries.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(InitialState)
+{
+  util::RttEstimator::Options rttOptions;
+  rttOptions.k = 8;
+  rttOptions.minRto = 10_ms;
+  // 20ms + 8 * 5ms
+  BOOST_CHECK_EQUAL(WarmStartCache::getInitialRto(makeEntry(0_s), rttOptions), 60_ms);
+
+  rttOptions.minRto = 100_ms;
+  BOOST_CHECK_EQUAL(WarmStartCache::getInitialRto(makeEntry(0_s), rttOptions), 100_ms);
+
+  auto window = WarmStartCache::getInitialWindow(makeEntry(0_s, 40.0), 2.0);
+  BOOST_CHECK_EQUAL(window.cwnd, 20.0);
+  BOOST_CHECK_EQUAL(window.ssthresh, 30.0);
+
+  window = WarmStartCache::getInitialWindow(makeEntry(0_s, 3.0), 2.0);
+  BOOST_CHECK_EQUAL(window.cwnd, 2.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestWarmStartCache
+BOOST_AUTO_TEST_SUITE_END() // Get
+
+} // namespace ndn::tests
@@ -0,0 +1,232 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "batch-fetcher.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+#include <set>
+#include <sstream>
+
+namespace ndn::get {
+
+std::vector<BatchFetcher::Item>
+BatchFetcher::parseList(std::istream& is, const std::string& outputDir)
+{
+  std::vector<Item> items;
+  std::set<std::string> outputPaths;
+  std::string line;
+  size_t lineNo = 0;
+
+  while (std::getline(is, line)) {
+    ++lineNo;
+    std::istringstream fields(line);
+    std::string uri, path, extra;
+    if (!(fields >> uri) || uri.front() == '#') {
+      continue;
+    }
+    fields >> path;
+    if (fields >> extra) {
+      NDN_THROW(Error("Line " + std::to_string(lineNo) + ": unexpected '" + extra + "'"));
+    }
+
+    Item item;
+    try {
+      item.name = Name(uri);
+    }
+    catch (const std::exception& e) {
+      NDN_THROW(Error("Line " + std::to_string(lineNo) + ": invalid name '" + uri + "': " + e.what()));
+    }
+
+    if (path.empty()) {
+      ssize_t i = static_cast<ssize_t>(item.name.size()) - 1;
+      while (i >= 0 && item.name[i].isVersion()) {
+        --i;
+      }
+      if (i < 0) {
+        NDN_THROW(Error("Line " + std::to_string(lineNo) + ": cannot derive a file name from " +
+                        item.name.toUri() + ", please specify the output file"));
+      }
+      path = item.name[i].toUri();
+      if (!outputDir.empty()) {
+        path = outputDir + (outputDir.back() == '/' ? "" : "/") + path;
+      }
+    }
+
+    if (!outputPaths.insert(path).second) {
+      NDN_THROW(Error("Line " + std::to_string(lineNo) + ": '" + path +
+                      "' is the output file of another object"));
+    }
+    item.outputPath = std::move(path);
+    items.push_back(std::move(item));
+  }
+
+  return items;
+}
+
+BatchFetcher::BatchFetcher(Face& face, security::Validator& validator, const Options& options,
+                           PipelineFactory makePipeline, size_t maxConcurrent,
+                           std::shared_ptr<const RttEstimatorWithStats::Options> rttOptions)
+  : m_face(face)
+  , m_validator(validator)
+  , m_options(options)
+  , m_makePipeline(std::move(makePipeline))
+  , m_maxConcurrent(maxConcurrent)
+  , m_rttOptions(std::move(rttOptions))
+{
+  BOOST_ASSERT(m_makePipeline != nullptr);
+  BOOST_ASSERT(m_maxConcurrent > 0);
+}
+
+void
+BatchFetcher::run(std::vector<Item> items)
+{
+  m_items = std::move(items);
+  m_nextItem = 0;
+  m_startTime = time::steady_clock::now();
+
+  if (m_maxConcurrent > 1) {
+    m_sharedRttEstimator = std::make_unique<RttEstimatorWithStats>(m_rttOptions);
+    m_windowOwner = m_makePipeline(*m_sharedRttEstimator);
+    auto adaptive = dynamic_cast<PipelineInterestsAdaptive*>(m_windowOwner.get());
+    if (adaptive == nullptr || !adaptive->canShareWindow()) {
+      m_windowOwner.reset();
+      m_sharedRttEstimator.reset();
+    }
+  }
+
+  startTransfers();
+}
+
+void
+BatchFetcher::startTransfers()
+{
+  while (m_active.size() < m_maxConcurrent && m_nextItem < m_items.size()) {
+    startTransfer(std::move(m_items[m_nextItem++]));
+  }
+}
+
+void
+BatchFetcher::startTransfer(Item item)
+{
+  bool isSequential = m_active.empty();
+  auto it = m_active.emplace(m_active.end());
+  it->item = std::move(item);
+
+  try {
+    it->file = std::make_unique<FileWriter>(it->item.outputPath);
+  }
+  catch (const FileWriter::Error& e) {
+    std::cerr << "ERROR: " << it->item.name << ": " << e.what() << "\n";
+    m_nFailed++;
+    m_active.erase(it);
+    return;
+  }
+
+  std::unique_ptr<PipelineInterests> pipeline;
+  if (m_windowOwner != nullptr) {
+    pipeline = m_makePipeline(*m_sharedRttEstimator);
+    it->adaptivePipeline = dynamic_cast<PipelineInterestsAdaptive*>(pipeline.get());
+    BOOST_ASSERT(it->adaptivePipeline != nullptr);
+    it->adaptivePipeline->shareWindowOf(static_cast<PipelineInterestsAdaptive&>(*m_windowOwner));
+  }
+  else {
+    bool isWarm = isSequential && m_windowState && m_rttState;
+    if (isWarm) {
+      it->rttEstimator = std::make_unique<RttEstimatorWithStats>(*m_rttState);
+    }
+    else {
+      it->rttEstimator = std::make_unique<RttEstimatorWithStats>(m_rttOptions);
+    }
+
+    pipeline = m_makePipeline(*it->rttEstimator);
+    it->adaptivePipeline = dynamic_cast<PipelineInterestsAdaptive*>(pipeline.get());
+    if (it->adaptivePipeline != nullptr && isWarm) {
+      it->adaptivePipeline->setWindowState(*m_windowState);
+    }
+  }
+
+  it->consumer = std::make_unique<Consumer>(m_validator, *it->file);
+  if (m_validationPool != nullptr) {
+    it->consumer->setValidationPool(*m_validationPool);
+  }
+  // the callbacks are invoked from within the consumer, which cannot be destroyed there
+  it->consumer->setCallbacks(
+    [this, it] {
+      boost::asio::post(m_face.getIoContext(), [this, it] { finishTransfer(it, nullptr); });
+    },
+    [this, it] (std::exception_ptr error) {
+      boost::asio::post(m_face.getIoContext(), [this, it, error] { finishTransfer(it, error); });
+    });
+
+  if (m_options.isVerbose) {
+    std::cerr << "Starting retrieval of " << it->item.name << " into " << it->item.outputPath << "\n";
+  }
+  it->consumer->run(std::make_unique<DiscoverVersion>(m_face, it->item.name, m_options),
+                    std::move(pipeline));
+}
+
+void
+BatchFetcher::finishTransfer(std::list<Transfer>::iterator it, std::exception_ptr error)
+{
+  if (error) {
+    try {
+      std::rethrow_exception(error);
+    }
+    catch (const std::exception& e) {
+      std::cerr << "ERROR: " << it->item.name << ": " << e.what() << "\n";
+    }
+    m_nFailed++;
+    m_failed.splice(m_failed.end(), m_active, it);
+  }
+  else {
+    if (it->adaptivePipeline != nullptr && it->rttEstimator != nullptr) {
+      m_windowState = it->adaptivePipeline->getWindowState();
+      m_rttState.emplace(*it->rttEstimator);
+    }
+    if (!m_options.isQuiet) {
+      std::cerr << "Retrieved " << it->item.name << " into " << it->item.outputPath << "\n";
+    }
+    m_nCompleted++;
+    m_active.erase(it);
+  }
+
+  startTransfers();
+}
+
+void
+BatchFetcher::printSummary() const
+{
+  using namespace ndn::time;
+  duration<double, seconds::period> timeElapsed = steady_clock::now() - m_startTime;
+
+  std::cerr << "\nObjects retrieved: " << m_nCompleted << " of " << m_items.size() << "\n";
+  if (m_nFailed > 0) {
+    std::cerr << "Objects failed: " << m_nFailed << "\n";
+  }
+  std::cerr << "Time elapsed: " << timeElapsed << "\n";
+}
+
+} // namespace ndn::get
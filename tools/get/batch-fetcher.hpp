@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_BATCH_FETCHER_HPP
+#define NDN_TOOLS_GET_BATCH_FETCHER_HPP
+
+#include "consumer.hpp"
+#include "pipeline-interests-adaptive.hpp"
+
+#include <istream>
+#include <list>
+#include <optional>
+
+namespace ndn::get {
+
+/**
+ * @brief Retrieves many objects concurrently over a single Face.
+ *
+ * Each object goes through its own version discovery and Interest pipeline and is written to
+ * its own output file. At most `maxConcurrent` objects are retrieved at the same time; the
+ * next object in the list is started as soon as a transfer completes or fails.
+ *
+ * If several objects may be retrieved at the same time and the pipelines are adaptive, all the
+ * transfers share one RTT estimator and one congestion window, which belongs to a pipeline that
+ * is created for this purpose and never run (see PipelineInterestsAdaptive::shareWindowOf()).
+ * The concurrent transfers thus compete for the path as a single flow, instead of each of them
+ * probing it with a window of its own, and a new transfer starts from what the others have
+ * learned about the path.
+ *
+ * Otherwise, every transfer has its own RTT estimator. A transfer that starts while no other
+ * transfer is active takes over the RTT estimator state and the window reached by the most
+ * recently completed transfer, instead of starting cold.
+ */
+class BatchFetcher : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  struct Item
+  {
+    Name name;
+    std::string outputPath;
+  };
+
+  /**
+   * @brief Creates the Interest pipeline of a transfer.
+   *
+   * The RTT estimator passed as argument belongs to the transfer, or is shared by the concurrent
+   * transfers, and outlives the pipeline; an adaptive pipeline must use it.
+   */
+  using PipelineFactory = std::function<std::unique_ptr<PipelineInterests>(RttEstimatorWithStats&)>;
+
+  /**
+   * @brief Parse a list of objects, one per line.
+   *
+   * Each line contains a name, optionally followed by the path of the output file. If no path
+   * is given, the object is written to a file in @p outputDir named after the last component
+   * of the name that is not a version. Empty lines and lines starting with '#' are ignored.
+   *
+   * @throw Error malformed line, or several objects would be written to the same file
+   */
+  static std::vector<Item>
+  parseList(std::istream& is, const std::string& outputDir = "");
+
+  /**
+   * @param makePipeline creates the Interest pipeline of each transfer
+   * @param maxConcurrent maximum number of objects retrieved at the same time
+   * @param rttOptions options of the RTT estimator of each transfer, nullptr for the defaults
+   */
+  BatchFetcher(Face& face, security::Validator& validator, const Options& options,
+               PipelineFactory makePipeline, size_t maxConcurrent,
+               std::shared_ptr<const RttEstimatorWithStats::Options> rttOptions = nullptr);
+
+  /**
+   * @brief Validate Data packets on the worker threads of @p pool, see Consumer::setValidationPool()
+   */
+  void
+  setValidationPool(ValidationPool& pool)
+  {
+    m_validationPool = &pool;
+  }
+
+  /**
+   * @brief Start retrieving @p items. The transfers progress while the Face processes events.
+   */
+  void
+  run(std::vector<Item> items);
+
+  size_t
+  getNCompleted() const
+  {
+    return m_nCompleted;
+  }
+
+  size_t
+  getNFailed() const
+  {
+    return m_nFailed;
+  }
+
+  void
+  printSummary() const;
+
+private:
+  struct Transfer
+  {
+    Item item;
+    std::unique_ptr<FileWriter> file;
+    std::unique_ptr<RttEstimatorWithStats> rttEstimator; ///< null if the RTT estimator is shared
+    std::unique_ptr<Consumer> consumer;
+    PipelineInterestsAdaptive* adaptivePipeline = nullptr; ///< owned by consumer, may be null
+  };
+
+  /**
+   * @brief Start transfers until the concurrency limit is reached or the list is exhausted
+   */
+  void
+  startTransfers();
+
+  void
+  startTransfer(Item item);
+
+  /**
+   * @brief Called asynchronously, once the consumer of @p it is no longer running
+   */
+  void
+  finishTransfer(std::list<Transfer>::iterator it, std::exception_ptr error);
+
+private:
+  Face& m_face;
+  security::Validator& m_validator;
+  const Options& m_options;
+  PipelineFactory m_makePipeline;
+  const size_t m_maxConcurrent;
+  std::shared_ptr<const RttEstimatorWithStats::Options> m_rttOptions;
+  ValidationPool* m_validationPool = nullptr;
+
+  std::vector<Item> m_items;
+  size_t m_nextItem = 0;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /// shared by the concurrent transfers, declared before them so that they are destroyed first
+  std::unique_ptr<RttEstimatorWithStats> m_sharedRttEstimator;
+  std::unique_ptr<PipelineInterests> m_windowOwner; ///< never run, holds the shared window
+  std::list<Transfer> m_active;
+  /// Failed transfers are kept until the end of the batch, because their consumer may still
+  /// receive callbacks, e.g., from a validation pool.
+  std::list<Transfer> m_failed;
+  /// state of the most recently completed adaptive transfer, handed over to sequential transfers
+  std::optional<PipelineInterestsAdaptive::WindowState> m_windowState;
+  std::optional<RttEstimatorWithStats> m_rttState;
+  size_t m_nCompleted = 0;
+  size_t m_nFailed = 0;
+  time::steady_clock::time_point m_startTime;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_BATCH_FETCHER_HPP
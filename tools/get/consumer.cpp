@@ -33,7 +33,19 @@ namespace ndn::get {
 
 Consumer::Consumer(security::Validator& validator, std::ostream& os)
   : m_validator(validator)
-  , m_outputStream(os)
+  , m_outputStream(&os)
+{
+}
+
+Consumer::Consumer(security::Validator& validator, VectoredWriter& writer)
+  : m_validator(validator)
+  , m_vectoredWriter(&writer)
+{
+}
+
+Consumer::Consumer(security::Validator& validator, FileWriter& file)
+  : m_validator(validator)
+  , m_fileWriter(&file)
 {
 }
 
@@ -42,48 +54,303 @@ Consumer::run(std::unique_ptr<DiscoverVersion> discover, std::unique_ptr<Pipelin
 {
   m_discover = std::move(discover);
   m_pipeline = std::move(pipeline);
-  m_nextToPrint = 0;
-  m_bufferedData.clear();
+
+  size_t maxWindowSize = m_pipeline->getMaxWindowSize();
+  m_reorderBuffer.reset(maxWindowSize > 0 ? maxWindowSize : ReorderBuffer::DEFAULT_CAPACITY);
+  m_pipeline->setBacklogCallback([this] { return getBacklog(); });
+
+  if (m_resumeState != nullptr && m_resumeState->hasLayout()) {
+    m_hasLastSegmentNo = true;
+    m_lastSegmentNo = m_resumeState->getLastSegmentNo();
+    m_segmentSize = m_resumeState->getSegmentSize();
+    m_nSegmentsWritten = m_resumeState->getNWritten();
+    m_pipeline->resumeFrom(m_lastSegmentNo,
+                           [state = m_resumeState] (uint64_t segNo) { return state->isWritten(segNo); },
+                           m_resumeState->getNWritten());
+  }
 
   m_discover->onDiscoverySuccess.connect([this] (const Name& versionedName) {
+    if (m_resumeState != nullptr && !m_resumeState->hasLayout()) {
+      m_resumeState->reset(versionedName);
+    }
+    if (auto lastSegmentNo = m_discover->getLastSegmentNo(); lastSegmentNo) {
+      m_pipeline->setLastSegmentNoHint(*lastSegmentNo);
+    }
+    if (auto data = m_discover->getProbedData(); data != nullptr) {
+      // the segment that revealed the version is not fetched again
+      m_pipeline->setPrefetchedSegment(std::move(data));
+    }
     m_pipeline->run(versionedName,
-                    FORWARD_TO_MEM_FN(handleData),
-                    [] (const std::string& msg) { NDN_THROW(std::runtime_error(msg)); });
+                    [this] (const Data& data) { handleErrors([&] { handleData(data); }); },
+                    [this] (const std::string& msg) {
+                      handleErrors([&] { NDN_THROW(std::runtime_error(msg)); });
+                    });
   });
-  m_discover->onDiscoveryFailure.connect([] (const std::string& msg) {
-    NDN_THROW(std::runtime_error(msg));
+  m_discover->onDiscoveryFailure.connect([this] (const std::string& msg) {
+    handleErrors([&] { NDN_THROW(std::runtime_error(msg)); });
   });
   m_discover->run();
 }
 
+template<typename Func>
+void
+Consumer::handleErrors(Func&& func)
+{
+  if (!m_onFailure) {
+    func();
+    return;
+  }
+
+  if (m_hasFailed) {
+    // the transfer has already been stopped, ignore late callbacks
+    return;
+  }
+
+  try {
+    func();
+  }
+  catch (const std::exception&) {
+    if (m_hasFailed) {
+      return;
+    }
+    m_hasFailed = true;
+    m_pipeline->cancel();
+    m_onFailure(std::current_exception());
+  }
+}
+
 void
 Consumer::handleData(const Data& data)
 {
   auto dataPtr = data.shared_from_this();
 
-  m_validator.validate(data,
-    [this, dataPtr] (const Data& data) {
-      if (data.getContentType() == ndn::tlv::ContentType_Nack) {
-        NDN_THROW(ApplicationNackError(data));
-      }
+  if (m_validationPool != nullptr) {
+    m_validationPool->validate(dataPtr,
+      [this] (std::shared_ptr<const Data> data) {
+        handleErrors([&] { handleValidatedData(std::move(data)); });
+        // the validation queue has shrunk
+        m_pipeline->notifyBacklogReduced();
+      },
+      [this] (std::shared_ptr<const Data>, const security::ValidationError& error) {
+        handleErrors([&] { NDN_THROW(DataValidationError(error)); });
+      });
+    return;
+  }
 
-      // 'data' passed to callback comes from DataValidationState and was not created with make_shared
-      m_bufferedData[getSegmentFromPacket(data)] = dataPtr;
-      writeInOrderData();
+  m_validator.validate(data,
+    // 'data' passed to callback comes from DataValidationState and was not created with make_shared
+    [this, dataPtr] (const Data&) {
+      handleErrors([&] { handleValidatedData(dataPtr); });
     },
-    [] (const Data&, const security::ValidationError& error) {
-      NDN_THROW(DataValidationError(error));
+    [this] (const Data&, const security::ValidationError& error) {
+      handleErrors([&] { NDN_THROW(DataValidationError(error)); });
     });
 }
 
+void
+Consumer::handleValidatedData(std::shared_ptr<const Data> data)
+{
+  if (data->getContentType() == ndn::tlv::ContentType_Nack) {
+    NDN_THROW(ApplicationNackError(*data));
+  }
+
+  if (m_fileWriter != nullptr) {
+    writeToFile(std::move(data));
+  }
+  else {
+    uint64_t segNo = getSegmentFromPacket(*data);
+    m_reorderBuffer.insert(segNo, std::move(data));
+    writeInOrderData();
+  }
+}
+
 void
 Consumer::writeInOrderData()
 {
-  for (auto it = m_bufferedData.begin();
-       it != m_bufferedData.end() && it->first == m_nextToPrint;
-       it = m_bufferedData.erase(it), ++m_nextToPrint) {
-    const Block& content = it->second->getContent();
-    m_outputStream.write(reinterpret_cast<const char*>(content.value()), content.value_size());
+  size_t nDrained = 0;
+  if (m_vectoredWriter != nullptr) {
+    nDrained = m_reorderBuffer.drain([this] (std::shared_ptr<const Data> data) {
+      m_vectoredWriter->append(std::move(data));
+    });
+    m_vectoredWriter->requestFlush();
+  }
+  else {
+    nDrained = m_reorderBuffer.drain([this] (std::shared_ptr<const Data> data) {
+      const Block& content = data->getContent();
+      m_outputStream->write(reinterpret_cast<const char*>(content.value()), content.value_size());
+    });
+  }
+
+  if (nDrained > 0 && m_pipeline != nullptr) {
+    m_pipeline->notifyBacklogReduced();
+  }
+}
+
+void
+Consumer::writeToFile(std::shared_ptr<const Data> data)
+{
+  BOOST_ASSERT(m_fileWriter != nullptr);
+
+  uint64_t segNo = getSegmentFromPacket(*data);
+  if (data->getFinalBlock()) {
+    uint64_t lastSegmentNo = data->getFinalBlock()->toSegment();
+    if (!m_hasLastSegmentNo) {
+      m_lastSegmentNo = lastSegmentNo;
+      m_hasLastSegmentNo = true;
+      if (m_segmentSize > 0) {
+        m_fileWriter->preallocate((m_lastSegmentNo + 1) * m_segmentSize);
+      }
+    }
+    else if (lastSegmentNo != m_lastSegmentNo) {
+      NDN_THROW(std::runtime_error("Segment #" + std::to_string(segNo) + " has FinalBlockId " +
+                                   std::to_string(lastSegmentNo) + " (expected " +
+                                   std::to_string(m_lastSegmentNo) + ")"));
+    }
+  }
+
+  if (m_segmentSize == 0) {
+    // the segment size can only be learned from a segment that is known not to be the last one:
+    // one before the FinalBlockId, or any segment as soon as a later segment has been received
+    std::optional<uint64_t> sizeSegNo;
+    if (m_hasLastSegmentNo && segNo < m_lastSegmentNo) {
+      sizeSegNo = segNo;
+    }
+    else if (m_lowestSegNo && *m_lowestSegNo < segNo) {
+      sizeSegNo = *m_lowestSegNo;
+    }
+    else if (m_lowestSegNo && segNo < *m_lowestSegNo) {
+      sizeSegNo = segNo;
+    }
+
+    if (!m_lowestSegNo || segNo < *m_lowestSegNo) {
+      m_lowestSegNo = segNo;
+      m_lowestSegmentSize = data->getContent().value_size();
+    }
+
+    if (sizeSegNo) {
+      m_segmentSize = *sizeSegNo == segNo ? data->getContent().value_size() : m_lowestSegmentSize;
+      if (m_segmentSize == 0) {
+        NDN_THROW(std::runtime_error("Segment #" + std::to_string(*sizeSegNo) + " is empty"));
+      }
+      if (m_hasLastSegmentNo) {
+        m_fileWriter->preallocate((m_lastSegmentNo + 1) * m_segmentSize);
+      }
+    }
+    else if (segNo > 0) {
+      // the offset of this segment is not known yet
+      m_pendingWrites.push_back(std::move(data));
+      return;
+    }
+  }
+
+  if (m_resumeState != nullptr && !m_resumeState->hasLayout() && m_hasLastSegmentNo &&
+      (m_segmentSize > 0 || m_lastSegmentNo == 0)) {
+    m_resumeState->setLayout(m_lastSegmentNo, m_segmentSize);
+  }
+
+  writeSegmentAt(segNo, *data);
+
+  if (m_segmentSize > 0 && !m_pendingWrites.empty()) {
+    auto pendingWrites = std::move(m_pendingWrites);
+    m_pendingWrites.clear();
+    for (const auto& pending : pendingWrites) {
+      writeSegmentAt(getSegmentFromPacket(*pending), *pending);
+    }
+    if (m_pipeline != nullptr) {
+      m_pipeline->notifyBacklogReduced();
+    }
+  }
+
+  if (m_onComplete && hasWrittenAllSegments()) {
+    m_onComplete();
+  }
+}
+
+void
+Consumer::writeSegmentAt(uint64_t segNo, const Data& data)
+{
+  const Block& content = data.getContent();
+  if (segNo > 0) {
+    BOOST_ASSERT(m_segmentSize > 0);
+    bool isLast = m_hasLastSegmentNo && segNo == m_lastSegmentNo;
+    if (isLast ? content.value_size() > m_segmentSize : content.value_size() != m_segmentSize) {
+      NDN_THROW(std::runtime_error("Segment #" + std::to_string(segNo) + " has size " +
+                                   std::to_string(content.value_size()) + " (expected " +
+                                   std::to_string(m_segmentSize) + "), writing to a file "
+                                   "requires all segments except the last one to have the same size"));
+    }
+  }
+
+  m_fileWriter->write(segNo * m_segmentSize, make_span(content.value(), content.value_size()));
+  m_nSegmentsWritten++;
+
+  if (m_resumeState != nullptr) {
+    m_resumeState->markWritten(segNo);
+  }
+}
+
+bool
+Consumer::hasWrittenAllSegments() const
+{
+  BOOST_ASSERT(m_fileWriter != nullptr);
+  return m_hasLastSegmentNo && m_nSegmentsWritten == m_lastSegmentNo + 1;
+}
+
+size_t
+Consumer::getBacklog() const
+{
+  size_t backlog = m_reorderBuffer.size() + m_pendingWrites.size();
+  if (m_validationPool != nullptr) {
+    backlog += m_validationPool->getNOutstanding();
+  }
+  return backlog;
+}
+
+void
+Consumer::printSummary() const
+{
+  if (m_fileWriter != nullptr) {
+    std::cerr << "Output written to: " << m_fileWriter->getPath() << "\n";
+    if (m_resumeState != nullptr && m_resumeState->hasLayout()) {
+      std::cerr << "Segments on disk: " << m_resumeState->getNWritten() << " of "
+                << m_resumeState->getLastSegmentNo() + 1 << "\n";
+    }
+  }
+  else {
+    std::cerr << "Reorder buffer high-water mark: " << m_reorderBuffer.getHighWaterMark()
+              << " segments\n";
+  }
+
+  if (m_validationPool != nullptr) {
+    m_validationPool->printSummary();
+  }
+
+  if (m_vectoredWriter != nullptr) {
+    std::cerr << "Output: " << m_vectoredWriter->getNBytesWritten() << " bytes in "
+              << m_vectoredWriter->getNWriteCalls() << " write calls\n";
+  }
+}
+
+void
+Consumer::writeReport(JsonWriter& json) const
+{
+  json.beginObject("consumer");
+  if (m_fileWriter != nullptr) {
+    json.member("outputPath", m_fileWriter->getPath());
+  }
+  else {
+    json.member("outputPath", nullptr);
+  }
+  json.member("reorderBufferHighWaterMark", m_reorderBuffer.getHighWaterMark());
+  json.endObject();
+
+  if (m_pipeline != nullptr) {
+    json.beginObject("pipeline");
+    m_pipeline->writeReport(json);
+    json.endObject();
+  }
+  else {
+    json.member("pipeline", nullptr);
   }
 }
 
@@ -29,14 +29,22 @@
 #define NDN_TOOLS_GET_CONSUMER_HPP
 
 #include "discover-version.hpp"
+#include "file-writer.hpp"
 #include "pipeline-interests.hpp"
+#include "reorder-buffer.hpp"
+#include "resume-state.hpp"
+#include "validation-pool.hpp"
+#include "vectored-writer.hpp"
 
 #include <ndn-cxx/security/validation-error.hpp>
 #include <ndn-cxx/security/validator.hpp>
 
 #include <boost/lexical_cast.hpp>
+#include <exception>
+#include <functional>
 #include <iostream>
-#include <map>
+#include <optional>
+#include <vector>
 
 namespace ndn::get {
 
@@ -45,7 +53,7 @@ namespace ndn::get {
  *
  * Discover the latest version of the data published under a specified prefix, and retrieve all the
  * segments associated to that version. The segments are fetched in order and written to a
- * user-specified stream in the same order.
+ * user-specified stream in the same order, or directly at their offset in a user-specified file.
  */
 class Consumer : noncopyable
 {
@@ -71,34 +79,157 @@ public:
   };
 
   /**
-   * @brief Create the consumer
+   * @brief Create a consumer that writes the content in order to @p os
    */
   explicit
   Consumer(security::Validator& validator, std::ostream& os = std::cout);
 
+  /**
+   * @brief Create a consumer that writes the content in order through @p writer
+   *
+   * The in-order segments are written in batches, with one (vectored) system call per batch,
+   * see VectoredWriter::requestFlush().
+   */
+  Consumer(security::Validator& validator, VectoredWriter& writer);
+
+  /**
+   * @brief Create a consumer that writes each segment at its offset in @p file
+   *
+   * No reordering is performed. All segments except the last one must have the same size.
+   */
+  Consumer(security::Validator& validator, FileWriter& file);
+
+  /**
+   * @brief Validate Data packets on the worker threads of @p pool instead of the I/O thread
+   *
+   * Must be called before run(). @p pool must outlive the consumer.
+   */
+  void
+  setValidationPool(ValidationPool& pool)
+  {
+    m_validationPool = &pool;
+  }
+
+  /**
+   * @brief Record the segments written to the output file in @p state
+   *
+   * If @p state describes a previous transfer, the segments already written are not fetched
+   * again. Only supported when writing to a file. Must be called before run().
+   * @p state must outlive the consumer.
+   */
+  void
+  setResumeState(ResumeState& state)
+  {
+    BOOST_ASSERT(m_fileWriter != nullptr);
+    m_resumeState = &state;
+  }
+
+  using CompletionCallback = std::function<void()>;
+  using FailureCallback = std::function<void(std::exception_ptr error)>;
+
+  /**
+   * @brief Report the outcome of the transfer through callbacks
+   *
+   * @p onComplete is invoked once every segment has been written to the output file.
+   * When an error occurs, the transfer is stopped and @p onFailure is invoked with the
+   * exception that would otherwise have been thrown from the event loop; the consumer
+   * must not be destroyed before all pending callbacks have been invoked.
+   * Only supported when writing to a file. Must be called before run().
+   */
+  void
+  setCallbacks(CompletionCallback onComplete, FailureCallback onFailure)
+  {
+    BOOST_ASSERT(m_fileWriter != nullptr);
+    m_onComplete = std::move(onComplete);
+    m_onFailure = std::move(onFailure);
+  }
+
   /**
    * @brief Run the consumer
    */
   void
   run(std::unique_ptr<DiscoverVersion> discover, std::unique_ptr<PipelineInterests> pipeline);
 
+  /**
+   * @brief Return whether every segment of the content has been written to the output file
+   *
+   * Only supported when writing to a file.
+   */
+  bool
+  hasWrittenAllSegments() const;
+
+  /**
+   * @brief Return the number of segments received but not yet written to the output
+   *
+   * This includes the segments waiting in the reorder buffer, for validation, or for the segment
+   * size to be known when writing to a file.
+   */
+  size_t
+  getBacklog() const;
+
+  /**
+   * @brief Print statistics about the consumer side of the transfer
+   */
+  void
+  printSummary() const;
+
+  /**
+   * @brief Write the statistics of the consumer and of its pipeline as members "consumer"
+   *        and "pipeline" of the current JSON object
+   */
+  void
+  writeReport(JsonWriter& json) const;
+
 private:
+  /**
+   * @brief Invoke @p func, passing the exceptions it throws to the failure callback if one is set
+   */
+  template<typename Func>
+  void
+  handleErrors(Func&& func);
+
   void
   handleData(const Data& data);
 
+  void
+  handleValidatedData(std::shared_ptr<const Data> data);
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   writeInOrderData();
 
+  void
+  writeToFile(std::shared_ptr<const Data> data);
+
+private:
+  void
+  writeSegmentAt(uint64_t segNo, const Data& data);
+
 private:
   security::Validator& m_validator;
-  std::ostream& m_outputStream;
+  ValidationPool* m_validationPool = nullptr;
+  std::ostream* m_outputStream = nullptr;
+  VectoredWriter* m_vectoredWriter = nullptr;
+  FileWriter* m_fileWriter = nullptr;
+  ResumeState* m_resumeState = nullptr;
   std::unique_ptr<DiscoverVersion> m_discover;
   std::unique_ptr<PipelineInterests> m_pipeline;
-  uint64_t m_nextToPrint = 0;
+  CompletionCallback m_onComplete;
+  FailureCallback m_onFailure;
+  bool m_hasFailed = false;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
-  std::map<uint64_t, std::shared_ptr<const Data>> m_bufferedData;
+  ReorderBuffer m_reorderBuffer;
+
+  // state of direct-to-file output
+  bool m_hasLastSegmentNo = false;
+  uint64_t m_lastSegmentNo = 0;
+  size_t m_segmentSize = 0; ///< size of every segment except the last one, 0 if not yet known
+  std::optional<uint64_t> m_lowestSegNo; ///< lowest segment received so far, if any
+  size_t m_lowestSegmentSize = 0; ///< size of segment m_lowestSegNo
+  uint64_t m_nSegmentsWritten = 0;
+  std::vector<std::shared_ptr<const Data>> m_pendingWrites; ///< segments received before
+                                                            ///< m_segmentSize was known
 };
 
 } // namespace ndn::get
@@ -51,19 +51,34 @@ DiscoverVersion::run()
   }
 
   Interest interest = MetadataObject::makeDiscoveryInterest(m_prefix)
+                      .setForwardingHint(m_options.forwardingHint)
                       .setInterestLifetime(m_options.interestLifetime);
 
+  m_nPending = 1;
   m_fetcher = DataFetcher::fetch(m_face, interest,
                                  m_options.maxRetriesOnTimeoutOrNack,
                                  m_options.maxRetriesOnTimeoutOrNack,
                                  FORWARD_TO_MEM_FN(handleData),
-                                 [this] (const auto&, const auto& reason) {
-                                   onDiscoveryFailure(reason);
-                                 },
-                                 [this] (const auto&, const auto& reason) {
-                                   onDiscoveryFailure(reason);
-                                 },
+                                 [this] (const auto&, const auto& reason) { fail(reason, false); },
+                                 [this] (const auto&, const auto& reason) { fail(reason, false); },
                                  m_options.isVerbose);
+
+  if (m_options.enableVersionProbe) {
+    Interest probe(m_prefix);
+    probe.setCanBePrefix(true)
+         .setMustBeFresh(m_options.mustBeFresh)
+         .setForwardingHint(m_options.forwardingHint)
+         .setInterestLifetime(m_options.interestLifetime);
+
+    m_nPending++;
+    m_probeFetcher = DataFetcher::fetch(m_face, probe,
+                                        m_options.maxRetriesOnTimeoutOrNack,
+                                        m_options.maxRetriesOnTimeoutOrNack,
+                                        FORWARD_TO_MEM_FN(handleProbeData),
+                                        [this] (const auto&, const auto& reason) { fail(reason, true); },
+                                        [this] (const auto&, const auto& reason) { fail(reason, true); },
+                                        m_options.isVerbose);
+  }
 }
 
 void
@@ -78,12 +93,12 @@ DiscoverVersion::handleData(const Interest& interest, const Data& data)
     mobject = MetadataObject(data);
   }
   catch (const tlv::Error& e) {
-    onDiscoveryFailure("Invalid metadata packet: "s + e.what());
+    fail("Invalid metadata packet: "s + e.what(), false);
     return;
   }
 
   if (mobject.getVersionedName().empty() || !mobject.getVersionedName()[-1].isVersion()) {
-    onDiscoveryFailure(mobject.getVersionedName().toUri() + " is not a valid versioned name");
+    fail(mobject.getVersionedName().toUri() + " is not a valid versioned name", false);
     return;
   }
 
@@ -91,7 +106,71 @@ DiscoverVersion::handleData(const Interest& interest, const Data& data)
     std::cerr << "Discovered Data version: " << mobject.getVersionedName()[-1] << "\n";
   }
 
-  onDiscoverySuccess(mobject.getVersionedName());
+  succeed(mobject.getVersionedName());
+}
+
+void
+DiscoverVersion::handleProbeData(const Interest& interest, const Data& data)
+{
+  if (m_options.isVerbose)
+    std::cerr << "Probe Data: " << data.getName() << "\n";
+
+  // only a segment of a versioned object directly under the prefix reveals the version
+  const Name& name = data.getName();
+  if (name.size() != m_prefix.size() + 2 || !name[-2].isVersion() || !name[-1].isSegment()) {
+    fail(name.toUri() + " is not a segment of a versioned object", true);
+    return;
+  }
+
+  if (m_options.isVerbose) {
+    std::cerr << "Probed Data version: " << name[-2] << "\n";
+  }
+
+  if (!m_isDone) {
+    m_probedData = data.shared_from_this();
+    if (data.getFinalBlock() && data.getFinalBlock()->isSegment()) {
+      m_lastSegmentNo = data.getFinalBlock()->toSegment();
+    }
+  }
+  succeed(name.getPrefix(-1));
+}
+
+void
+DiscoverVersion::succeed(const Name& versionedName)
+{
+  if (m_isDone)
+    return;
+
+  m_isDone = true;
+  // the other Interest may still be pending, its result is no longer needed
+  if (m_fetcher != nullptr) {
+    m_fetcher->cancel();
+  }
+  if (m_probeFetcher != nullptr) {
+    m_probeFetcher->cancel();
+  }
+  onDiscoverySuccess(versionedName);
+}
+
+void
+DiscoverVersion::fail(const std::string& reason, bool isProbe)
+{
+  if (m_isDone)
+    return;
+
+  // the failure of the discovery Interest is the one worth reporting
+  if (!isProbe || m_failureReason.empty()) {
+    m_failureReason = reason;
+  }
+  if (--m_nPending > 0) {
+    if (m_options.isVerbose) {
+      std::cerr << (isProbe ? "Version probe" : "Version discovery") << " failed: " << reason << "\n";
+    }
+    return;
+  }
+
+  m_isDone = true;
+  onDiscoveryFailure(m_failureReason);
 }
 
 } // namespace ndn::get
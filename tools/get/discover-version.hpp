@@ -34,6 +34,8 @@
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/util/signal.hpp>
 
+#include <optional>
+
 namespace ndn::get {
 
 class DataFetcher;
@@ -43,6 +45,10 @@ class DataFetcher;
  *
  * DiscoverVersion's user is notified once after identifying the latest retrievable version or
  * on failure to find any Data version.
+ *
+ * If Options::enableVersionProbe is set, a CanBePrefix Interest for the prefix is sent together
+ * with the discovery Interest. If it brings back a segment of a versioned object, that version
+ * is used without waiting for the metadata; discovery only fails if both Interests fail.
  */
 class DiscoverVersion
 {
@@ -62,15 +68,57 @@ public:
   void
   run();
 
+  /**
+   * @brief Return the last segment number of the content, if the version was found by
+   *        the CanBePrefix Interest and its Data carries a FinalBlockId.
+   */
+  std::optional<uint64_t>
+  getLastSegmentNo() const
+  {
+    return m_lastSegmentNo;
+  }
+
+  /**
+   * @brief Return the segment brought back by the CanBePrefix Interest, if it revealed
+   *        the version, so that it does not need to be fetched again.
+   */
+  std::shared_ptr<const Data>
+  getProbedData() const
+  {
+    return m_probedData;
+  }
+
 private:
   void
   handleData(const Interest& interest, const Data& data);
 
+  void
+  handleProbeData(const Interest& interest, const Data& data);
+
+  /**
+   * @brief Report the versioned name found by either Interest, and stop the other one
+   */
+  void
+  succeed(const Name& versionedName);
+
+  /**
+   * @brief Report a failure once neither Interest can find the version anymore
+   * @param isProbe whether the failure concerns the CanBePrefix Interest
+   */
+  void
+  fail(const std::string& reason, bool isProbe);
+
 private:
   Face& m_face;
   const Name m_prefix;
   const Options& m_options;
   std::shared_ptr<DataFetcher> m_fetcher;
+  std::shared_ptr<DataFetcher> m_probeFetcher;
+  std::optional<uint64_t> m_lastSegmentNo; ///< from the FinalBlockId of the probed Data
+  std::shared_ptr<const Data> m_probedData; ///< the probed Data, if it revealed the version
+  std::string m_failureReason; ///< reported if both Interests fail
+  int m_nPending = 0;          ///< number of Interests that have neither succeeded nor failed
+  bool m_isDone = false;
 };
 
 } // namespace ndn::get
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "file-writer.hpp"
+
+#include <ndn-cxx/util/exception.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ndn::get {
+
+FileWriter::FileWriter(const std::string& path, bool truncate)
+  : m_path(path)
+{
+  m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | (truncate ? O_TRUNC : 0) | O_CLOEXEC, 0666);
+  if (m_fd < 0) {
+    NDN_THROW(Error("Cannot open '" + path + "': " + std::strerror(errno)));
+  }
+}
+
+FileWriter::~FileWriter()
+{
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+}
+
+void
+FileWriter::preallocate(uint64_t size)
+{
+#ifdef __linux__
+  if (size > 0) {
+    // keep the apparent file size unchanged, the last segment will extend it to its final value
+    ::fallocate(m_fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(size));
+  }
+#endif
+}
+
+void
+FileWriter::write(uint64_t offset, span<const uint8_t> buf)
+{
+  const uint8_t* ptr = buf.data();
+  size_t remaining = buf.size();
+
+  while (remaining > 0) {
+    ssize_t n = ::pwrite(m_fd, ptr, remaining, static_cast<off_t>(offset));
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      NDN_THROW(Error("Cannot write to '" + m_path + "': " + std::strerror(errno)));
+    }
+    ptr += n;
+    offset += static_cast<uint64_t>(n);
+    remaining -= static_cast<size_t>(n);
+  }
+}
+
+} // namespace ndn::get
@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_FILE_WRITER_HPP
+#define NDN_TOOLS_GET_FILE_WRITER_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/util/span.hpp>
+
+namespace ndn::get {
+
+/**
+ * @brief Writes data at arbitrary offsets of a regular file.
+ *
+ * Used by the consumer to store each segment at its final position as soon as it is
+ * validated, so that segments never need to be reordered in memory.
+ */
+class FileWriter : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Open the file at @p path for writing.
+   * @param truncate whether to discard the existing content of the file
+   * @throw Error the file cannot be opened
+   */
+  explicit
+  FileWriter(const std::string& path, bool truncate = true);
+
+  ~FileWriter();
+
+  /**
+   * @brief Reserve disk space for the first @p size bytes of the file.
+   *
+   * This is only an optimization: it does not change the file size and failures are ignored.
+   */
+  void
+  preallocate(uint64_t size);
+
+  /**
+   * @brief Write @p buf at position @p offset in the file.
+   * @throw Error the write failed
+   */
+  void
+  write(uint64_t offset, span<const uint8_t> buf);
+
+  const std::string&
+  getPath() const
+  {
+    return m_path;
+  }
+
+private:
+  std::string m_path;
+  int m_fd = -1;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_FILE_WRITER_HPP
@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "json-writer.hpp"
+
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+
+namespace ndn::get {
+
+JsonWriter::JsonWriter(std::ostream& os)
+  : m_os(os)
+{
+}
+
+JsonWriter&
+JsonWriter::beginObject()
+{
+  beginValue(std::nullopt);
+  m_os << '{';
+  m_isEmpty.push_back(true);
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::beginObject(std::string_view key)
+{
+  beginValue(key);
+  m_os << '{';
+  m_isEmpty.push_back(true);
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::endObject()
+{
+  end('}');
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::beginArray(std::string_view key)
+{
+  beginValue(key);
+  m_os << '[';
+  m_isEmpty.push_back(true);
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::endArray()
+{
+  end(']');
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::member(std::string_view key, std::nullptr_t)
+{
+  beginValue(key);
+  m_os << "null";
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::member(std::string_view key, bool value)
+{
+  beginValue(key);
+  m_os << (value ? "true" : "false");
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::member(std::string_view key, double value)
+{
+  beginValue(key);
+  if (std::isfinite(value)) {
+    m_os << std::defaultfloat << std::setprecision(12) << value;
+  }
+  else {
+    m_os << "null";
+  }
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::member(std::string_view key, std::string_view value)
+{
+  beginValue(key);
+  writeString(value);
+  return *this;
+}
+
+JsonWriter&
+JsonWriter::element(std::string_view value)
+{
+  beginValue(std::nullopt);
+  writeString(value);
+  return *this;
+}
+
+void
+JsonWriter::beginValue(std::optional<std::string_view> key)
+{
+  if (!m_isEmpty.empty()) {
+    if (!m_isEmpty.back()) {
+      m_os << ',';
+    }
+    m_isEmpty.back() = false;
+    m_os << '\n' << std::string(2 * m_isEmpty.size(), ' ');
+  }
+  if (key) {
+    writeString(*key);
+    m_os << ": ";
+  }
+}
+
+void
+JsonWriter::end(char closing)
+{
+  BOOST_ASSERT(!m_isEmpty.empty());
+  bool isEmpty = m_isEmpty.back();
+  m_isEmpty.pop_back();
+  if (!isEmpty) {
+    m_os << '\n' << std::string(2 * m_isEmpty.size(), ' ');
+  }
+  m_os << closing;
+  if (m_isEmpty.empty()) {
+    m_os << '\n';
+  }
+}
+
+void
+JsonWriter::writeString(std::string_view str)
+{
+  m_os << '"';
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        m_os << "\\\"";
+        break;
+      case '\\':
+        m_os << "\\\\";
+        break;
+      case '\n':
+        m_os << "\\n";
+        break;
+      case '\r':
+        m_os << "\\r";
+        break;
+      case '\t':
+        m_os << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          m_os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+               << static_cast<int>(c) << std::dec << std::setfill(' ');
+        }
+        else {
+          m_os << c;
+        }
+        break;
+    }
+  }
+  m_os << '"';
+}
+
+} // namespace ndn::get
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_JSON_WRITER_HPP
+#define NDN_TOOLS_GET_JSON_WRITER_HPP
+
+#include "core/common.hpp"
+
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ndn::get {
+
+/**
+ * @brief Writes a JSON document to a stream, one value at a time.
+ *
+ * Objects and arrays are opened and closed explicitly; within an object, every value is
+ * preceded by its key. The output is indented by two spaces per nesting level. Non-finite
+ * floating-point numbers are written as null, as JSON cannot represent them.
+ */
+class JsonWriter : noncopyable
+{
+public:
+  explicit
+  JsonWriter(std::ostream& os);
+
+  /**
+   * @brief Open an object, as an element of the enclosing array or as the top-level value.
+   */
+  JsonWriter&
+  beginObject();
+
+  /**
+   * @brief Open an object as member @p key of the enclosing object.
+   */
+  JsonWriter&
+  beginObject(std::string_view key);
+
+  JsonWriter&
+  endObject();
+
+  /**
+   * @brief Open an array as member @p key of the enclosing object.
+   */
+  JsonWriter&
+  beginArray(std::string_view key);
+
+  JsonWriter&
+  endArray();
+
+  JsonWriter&
+  member(std::string_view key, std::nullptr_t);
+
+  JsonWriter&
+  member(std::string_view key, bool value);
+
+  template<typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+  JsonWriter&
+  member(std::string_view key, T value)
+  {
+    beginValue(key);
+    if constexpr (std::is_signed_v<T>) {
+      m_os << static_cast<int64_t>(value);
+    }
+    else {
+      m_os << static_cast<uint64_t>(value);
+    }
+    return *this;
+  }
+
+  JsonWriter&
+  member(std::string_view key, double value);
+
+  JsonWriter&
+  member(std::string_view key, std::string_view value);
+
+  JsonWriter&
+  member(std::string_view key, const char* value)
+  {
+    return member(key, std::string_view(value));
+  }
+
+  /**
+   * @brief Write @p value as an element of the enclosing array.
+   */
+  JsonWriter&
+  element(std::string_view value);
+
+private:
+  /**
+   * @brief Write the separator and indentation that precede a new value, and its key if any
+   */
+  void
+  beginValue(std::optional<std::string_view> key);
+
+  void
+  end(char closing);
+
+  void
+  writeString(std::string_view str);
+
+private:
+  std::ostream& m_os;
+  std::vector<bool> m_isEmpty; ///< for each open object or array, whether it has no values yet
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_JSON_WRITER_HPP
@@ -29,12 +29,20 @@
  * @author Chavoosh Ghasemi
  */
 
+#include "batch-fetcher.hpp"
 #include "consumer.hpp"
 #include "discover-version.hpp"
 #include "pipeline-interests-aimd.hpp"
+#include "pipeline-interests-bbr.hpp"
 #include "pipeline-interests-cubic.hpp"
 #include "pipeline-interests-fixed.hpp"
+#include "pipeline-interests-ledbat.hpp"
+#include "pipeline-interests-multipath.hpp"
+#include "pipeline-interests-striped.hpp"
 #include "statistics-collector.hpp"
+#include "statistics-sampler.hpp"
+#include "warm-start-cache.hpp"
+#include "core/program-options-ext.hpp"
 #include "core/version.hpp"
 
 #include <ndn-cxx/security/validator-null.hpp>
@@ -46,11 +54,107 @@
 
 #include <fstream>
 #include <iostream>
+#include <limits>
+
+#include <unistd.h>
 
 namespace ndn::get {
 
 namespace po = boost::program_options;
 
+/**
+ * @brief Create an adaptive pipeline of the specified (valid) type
+ */
+static std::unique_ptr<PipelineInterestsAdaptive>
+makeAdaptivePipeline(const std::string& type, Face& face, RttEstimatorWithStats& rttEstimator,
+                     const Options& options)
+{
+  if (type == "aimd") {
+    return std::make_unique<PipelineInterestsAimd>(face, rttEstimator, options);
+  }
+  if (type == "bbr") {
+    return std::make_unique<PipelineInterestsBbr>(face, rttEstimator, options);
+  }
+  if (type == "ledbat") {
+    return std::make_unique<PipelineInterestsLedbat>(face, rttEstimator, options);
+  }
+  BOOST_ASSERT(type == "cubic");
+  return std::make_unique<PipelineInterestsCubic>(face, rttEstimator, options);
+}
+
+/**
+ * @brief Create a pipeline of the specified (valid) type
+ * @param rttEstimator used by the adaptive pipelines, must not be null if @p type is not "fixed"
+ */
+static std::unique_ptr<PipelineInterests>
+makePipeline(const std::string& type, Face& face, RttEstimatorWithStats* rttEstimator,
+             const Options& options)
+{
+  if (type == "fixed") {
+    return std::make_unique<PipelineInterestsFixed>(face, options);
+  }
+
+  BOOST_ASSERT(rttEstimator != nullptr);
+  return makeAdaptivePipeline(type, face, *rttEstimator, options);
+}
+
+/**
+ * @brief Write the options of the transfer as members of the current JSON object
+ *
+ * All options are written, including those that do not apply to @p pipelineType,
+ * so that the members of the report do not depend on the command line.
+ */
+static void
+writeOptionsReport(JsonWriter& json, const std::string& pipelineType, size_t nStreams,
+                   const Options& options, const util::RttEstimator::Options& rttOptions)
+{
+  using time::duration_cast;
+  using time::milliseconds;
+
+  json.member("pipelineType", pipelineType)
+      .member("streams", nStreams)
+      .member("mustBeFresh", options.mustBeFresh)
+      .member("interestLifetimeMs", options.interestLifetime.count())
+      .member("maxRetries", options.maxRetriesOnTimeoutOrNack)
+      .member("maxBufferSize", options.maxBufferSize)
+      .member("versionDiscovery", !options.disableVersionDiscovery)
+      .member("probeVersion", options.enableVersionProbe)
+      .member("probeFinalBlock", options.probeFinalBlockId);
+  json.beginArray("forwardingHint");
+  for (const auto& delegation : options.forwardingHint) {
+    json.element(delegation.toUri());
+  }
+  json.endArray();
+
+  // an infinite initial slow start threshold is written as null
+  bool hasInitSsthresh = options.initSsthresh != std::numeric_limits<double>::max();
+  json.member("pipelineSize", options.maxPipelineSize)
+      .member("initCwnd", options.initCwnd)
+      .member("initSsthresh", hasInitSsthresh ? options.initSsthresh :
+                                                std::numeric_limits<double>::infinity())
+      .member("ignoreMarks", options.ignoreCongMarks)
+      .member("disableCwa", options.disableCwa)
+      .member("dctcp", options.enableDctcp)
+      .member("fastRetx", options.enableFastRetx)
+      .member("pacing", options.enablePacing)
+      .member("adaptiveLifetime", options.enableAdaptiveLifetime)
+      .member("minLifetimeMs", options.minLifetime.count())
+      .member("lifetimeMarginMs", options.lifetimeMargin.count())
+      .member("rtoAlpha", rttOptions.alpha)
+      .member("rtoBeta", rttOptions.beta)
+      .member("rtoK", rttOptions.k)
+      .member("initialRtoMs", duration_cast<milliseconds>(rttOptions.initialRto).count())
+      .member("minRtoMs", duration_cast<milliseconds>(rttOptions.minRto).count())
+      .member("maxRtoMs", duration_cast<milliseconds>(rttOptions.maxRto).count())
+      .member("aimdStep", options.aiStep)
+      .member("aimdBeta", options.mdCoef)
+      .member("resetCwndToInit", options.resetCwndToInit)
+      .member("cubicBeta", options.cubicBeta)
+      .member("cubicFastConv", options.enableFastConv)
+      .member("hystart", !options.disableHystart)
+      .member("targetDelayMs", options.targetDelay.count());
+}
+
 static int
 main(int argc, char* argv[])
 {
@@ -58,7 +162,11 @@ main(int argc, char* argv[])
 
   Options options;
   std::string prefix, nameConv, pipelineType("cubic");
-  std::string cwndPath, rttPath;
+  std::string cwndPath, rttPath, statsPath, outputPath, resumePath, batchPath, warmStartPath, reportPath;
+  size_t nValidationThreads = 0;
+  size_t maxConcurrent = 16;
+  size_t nStreams = 1;
+  time::seconds::rep warmStartMaxAge = 3600;
   auto rttEstOptions = std::make_shared<util::RttEstimator::Options>();
   rttEstOptions->k = 8; // increased from the ndn-cxx default of 4
 
@@ -69,14 +177,45 @@ main(int argc, char* argv[])
                     "only return fresh content (set MustBeFresh on all outgoing Interests)")
     ("lifetime,l",  po::value<time::milliseconds::rep>()->default_value(options.interestLifetime.count()),
                     "lifetime of expressed Interests, in milliseconds")
+    ("fwhint,F",    po::value<std::vector<Name>>(&options.forwardingHint)->composing(),
+                    "forwarding hint delegation to add to the Interests; if repeated, each delegation is "
+                    "a separate path and the segments are fetched over all of them in parallel")
     ("retries,r",   po::value<int>(&options.maxRetriesOnTimeoutOrNack)->default_value(options.maxRetriesOnTimeoutOrNack),
                     "maximum number of retries in case of Nack or timeout (-1 = no limit)")
     ("pipeline-type,p", po::value<std::string>(&pipelineType)->default_value(pipelineType),
-                        "type of Interest pipeline to use; valid values are: 'fixed', 'aimd', 'cubic'")
+                        "type of Interest pipeline to use; valid values are: 'fixed', 'aimd', 'cubic', 'bbr', 'ledbat'")
+    ("output,o",    po::value<std::string>(&outputPath),
+                    "write the content to the specified file instead of the standard output; "
+                    "segments are written at their offset as soon as they arrive")
+    ("resume",      po::value<std::string>(&resumePath),
+                    "record the segments written to the --output file in the specified state file, "
+                    "and only fetch the missing segments if it describes an interrupted transfer")
+    ("batch",       po::value<std::string>(&batchPath),
+                    "retrieve the objects listed in the specified file ('-' for the standard input), "
+                    "one per line as 'name [output-file]', concurrently over the same face; "
+                    "with this option, --output is the directory of the files that are not specified")
+    ("max-concurrent", po::value<size_t>(&maxConcurrent)->default_value(maxConcurrent),
+                       "maximum number of objects retrieved at the same time in --batch mode")
+    ("probe-final-block", po::bool_switch(&options.probeFinalBlockId),
+                          "until the last segment number is known, request only the first segment, "
+                          "then up to twice as many segments as received so far, instead of a full "
+                          "window that may extend beyond the end of the content")
+    ("max-buffer",  po::value<size_t>(&options.maxBufferSize)->default_value(options.maxBufferSize),
+                    "maximum number of out-of-order segments to buffer before pausing "
+                    "requests for new segments (0 = unlimited)")
+    ("validation-threads", po::value<size_t>(&nValidationThreads)->default_value(nValidationThreads),
+                           "number of worker threads used to validate Data packets "
+                           "(0 = validate on the I/O thread)")
     ("no-version-discovery,D", po::bool_switch(&options.disableVersionDiscovery),
                                "skip version discovery even if the name does not end with a version component")
+    ("probe-version", po::bool_switch(&options.enableVersionProbe),
+                      "send a CanBePrefix Interest for the name together with the version discovery "
+                      "Interest, and use the version of whichever reply comes first")
     ("naming-convention,N", po::value<std::string>(&nameConv),
                             "encoding convention to use for name components, either 'marker' or 'typed'")
+    ("report-json", po::value<std::string>(&reportPath),
+                    "at the end of the transfer, successful or not, write its options and statistics "
+                    "to the specified file in JSON format")
     ("quiet,q",     po::bool_switch(&options.isQuiet), "suppress all diagnostic output, except fatal errors")
     ("verbose,v",   po::bool_switch(&options.isVerbose), "turn on verbose output (per segment information")
     ("version,V",   "print program version and exit")
@@ -88,13 +227,34 @@ main(int argc, char* argv[])
                         "size of the Interest pipeline")
     ;
 
-  po::options_description adaptivePipeDesc("Adaptive pipeline options (AIMD & CUBIC)");
+  po::options_description adaptivePipeDesc("Adaptive pipeline options (AIMD, CUBIC, BBR & LEDBAT)");
   adaptivePipeDesc.add_options()
     ("ignore-marks",  po::bool_switch(&options.ignoreCongMarks),
                       "do not reduce the window after receiving a congestion mark")
     ("disable-cwa",   po::bool_switch(&options.disableCwa),
                       "disable Conservative Window Adaptation (reduce the window "
                       "on each congestion event instead of at most once per RTT)")
+    ("dctcp",         po::bool_switch(&options.enableDctcp),
+                      "react to congestion marks as DCTCP does, by decreasing the window once per "
+                      "window in proportion to the estimated fraction of marked packets")
+    ("fast-retx",     po::bool_switch(&options.enableFastRetx),
+                      "retransmit a segment as soon as 3 segments requested after it have been "
+                      "received, instead of waiting for its retransmission timer to expire")
+    ("pacing",        po::bool_switch(&options.enablePacing),
+                      "pace Interests at a rate of cwnd/srtt instead of sending them in bursts "
+                      "(the bbr pipeline always paces Interests)")
+    ("adaptive-lifetime", po::bool_switch(&options.enableAdaptiveLifetime),
+                          "set the lifetime of each Interest to its RTO plus --lifetime-margin, "
+                          "between --min-lifetime and --lifetime, so that the Interests retransmitted "
+                          "after a timeout do not keep forwarder state for longer than needed")
+    ("min-lifetime",  po::value<time::milliseconds::rep>()->default_value(options.minLifetime.count()),
+                      "minimum Interest lifetime with --adaptive-lifetime, in milliseconds")
+    ("lifetime-margin", po::value<time::milliseconds::rep>()->default_value(options.lifetimeMargin.count()),
+                        "time added to the RTO to obtain the Interest lifetime with --adaptive-lifetime, "
+                        "in milliseconds")
+    ("streams",       po::value<size_t>(&nStreams)->default_value(nStreams),
+                      "split the segments among the specified number of parallel pipelines, "
+                      "each with its own congestion window and RTT estimator")
     ("init-cwnd",     po::value<double>(&options.initCwnd)->default_value(options.initCwnd),
                       "initial congestion window in segments")
     ("init-ssthresh", po::value<double>(&options.initSsthresh),
@@ -111,8 +271,17 @@ main(int argc, char* argv[])
     ("max-rto",   po::value<time::milliseconds::rep>()->default_value(
                     time::duration_cast<time::milliseconds>(rttEstOptions->maxRto).count()),
                   "maximum RTO value, in milliseconds")
+    ("warm-start", po::value<std::string>(&warmStartPath),
+                   "cache file of the RTT and congestion window reached by previous transfers; the "
+                   "transfer starts from the entry of its prefix, and records its own at the end")
+    ("warm-start-max-age", po::value<time::seconds::rep>(&warmStartMaxAge)->default_value(warmStartMaxAge),
+                           "ignore the --warm-start entries recorded more than this many seconds ago")
     ("log-cwnd",  po::value<std::string>(&cwndPath), "log file for congestion window stats")
     ("log-rtt",   po::value<std::string>(&rttPath), "log file for round-trip time stats")
+    ("log-stats", po::value<std::string>(&statsPath),
+                  "log file for periodic transfer stats, with one row aggregating each --stats-interval")
+    ("stats-interval", po::value<time::milliseconds::rep>()->default_value(1000),
+                       "interval covered by each row of the --log-stats file, in milliseconds")
     ;
 
   po::options_description aimdPipeDesc("AIMD pipeline options");
@@ -130,6 +299,15 @@ main(int argc, char* argv[])
   cubicPipeDesc.add_options()
     ("cubic-beta", po::value<double>(&options.cubicBeta), "window decrease factor (defaults to 0.7)")
     ("fast-conv",  po::bool_switch(&options.enableFastConv), "enable fast convergence")
+    ("disable-hystart", po::bool_switch(&options.disableHystart),
+                        "do not end slow start early when the RTT samples show that the path is full")
+    ;
+
+  po::options_description ledbatPipeDesc("LEDBAT pipeline options");
+  ledbatPipeDesc.add_options()
+    ("target-delay", po::value<time::milliseconds::rep>()->default_value(options.targetDelay.count()),
+                     "target queueing delay, in milliseconds; the window shrinks when the "
+                     "RTT exceeds the minimum RTT by more than this amount")
     ;
 
   po::options_description visibleDesc;
@@ -137,7 +315,8 @@ main(int argc, char* argv[])
              .add(fixedPipeDesc)
              .add(adaptivePipeDesc)
              .add(aimdPipeDesc)
-             .add(cubicPipeDesc);
+             .add(cubicPipeDesc)
+             .add(ledbatPipeDesc);
 
   po::options_description hiddenDesc;
   hiddenDesc.add_options()
@@ -164,7 +343,8 @@ main(int argc, char* argv[])
   }
 
   if (vm.count("help") > 0) {
-    std::cout << "Usage: " << programName << " [options] ndn:/name\n";
+    std::cout << "Usage: " << programName << " [options] ndn:/name\n"
+              << "       " << programName << " [options] --batch FILE\n";
     std::cout << visibleDesc;
     return 0;
   }
@@ -174,8 +354,9 @@ main(int argc, char* argv[])
     return 0;
   }
 
-  if (prefix.empty()) {
-    std::cerr << "Usage: " << programName << " [options] ndn:/name\n";
+  if (prefix.empty() == batchPath.empty()) {
+    std::cerr << "Usage: " << programName << " [options] ndn:/name\n"
+              << "       " << programName << " [options] --batch FILE\n";
     std::cerr << visibleDesc;
     return 2;
   }
@@ -197,6 +378,19 @@ main(int argc, char* argv[])
     return 2;
   }
 
+  options.minLifetime = time::milliseconds(vm["min-lifetime"].as<time::milliseconds::rep>());
+  if (options.enableAdaptiveLifetime &&
+      (options.minLifetime <= 0_ms || options.minLifetime > options.interestLifetime)) {
+    std::cerr << "ERROR: --min-lifetime must be positive and not greater than --lifetime\n";
+    return 2;
+  }
+
+  options.lifetimeMargin = time::milliseconds(vm["lifetime-margin"].as<time::milliseconds::rep>());
+  if (options.lifetimeMargin < 0_ms) {
+    std::cerr << "ERROR: --lifetime-margin cannot be negative\n";
+    return 2;
+  }
+
   if (options.maxRetriesOnTimeoutOrNack < -1 || options.maxRetriesOnTimeoutOrNack > 1024) {
     std::cerr << "ERROR: --retries must be between -1 and 1024\n";
     return 2;
@@ -212,6 +406,99 @@ main(int argc, char* argv[])
     return 2;
   }
 
+  if (pipelineType != "fixed" && pipelineType != "aimd" && pipelineType != "cubic" &&
+      pipelineType != "bbr" && pipelineType != "ledbat") {
+    std::cerr << "ERROR: '" << pipelineType << "' is not a valid pipeline type\n";
+    return 2;
+  }
+
+  if (!batchPath.empty() && (!resumePath.empty() || !cwndPath.empty() || !rttPath.empty())) {
+    std::cerr << "ERROR: --batch cannot be combined with --resume, --log-cwnd, or --log-rtt\n";
+    return 2;
+  }
+
+  if (maxConcurrent < 1 || maxConcurrent > 1024) {
+    std::cerr << "ERROR: --max-concurrent must be between 1 and 1024\n";
+    return 2;
+  }
+
+  if (nStreams < 1 || nStreams > 64) {
+    std::cerr << "ERROR: --streams must be between 1 and 64\n";
+    return 2;
+  }
+
+  if (nStreams > 1 && pipelineType == "fixed") {
+    std::cerr << "ERROR: --streams requires an adaptive pipeline\n";
+    return 2;
+  }
+
+  if (nStreams > 1 && (!batchPath.empty() || !resumePath.empty() || !cwndPath.empty() || !rttPath.empty())) {
+    std::cerr << "ERROR: --streams cannot be combined with --batch, --resume, --log-cwnd, or --log-rtt\n";
+    return 2;
+  }
+
+  bool isMultipath = options.forwardingHint.size() > 1;
+  if (isMultipath && pipelineType == "fixed") {
+    std::cerr << "ERROR: multiple --fwhint require an adaptive pipeline\n";
+    return 2;
+  }
+
+  if (isMultipath && (nStreams > 1 || !batchPath.empty() || !resumePath.empty() ||
+                      !cwndPath.empty() || !rttPath.empty() || options.enableFastRetx ||
+                      options.probeFinalBlockId)) {
+    std::cerr << "ERROR: multiple --fwhint cannot be combined with --streams, --batch, --resume, "
+              << "--log-cwnd, --log-rtt, --fast-retx, or --probe-final-block\n";
+    return 2;
+  }
+
+  if (!statsPath.empty() && (pipelineType == "fixed" || !batchPath.empty() || nStreams > 1 || isMultipath)) {
+    std::cerr << "ERROR: --log-stats requires an adaptive pipeline, and cannot be combined with "
+              << "--batch, --streams, or multiple --fwhint\n";
+    return 2;
+  }
+
+  auto statsInterval = time::milliseconds(vm["stats-interval"].as<time::milliseconds::rep>());
+  if (statsInterval <= 0_ms) {
+    std::cerr << "ERROR: --stats-interval must be positive\n";
+    return 2;
+  }
+
+  if (!reportPath.empty() && !batchPath.empty()) {
+    std::cerr << "ERROR: --report-json cannot be combined with --batch\n";
+    return 2;
+  }
+
+  if (!warmStartPath.empty() && pipelineType == "fixed") {
+    std::cerr << "ERROR: --warm-start requires an adaptive pipeline\n";
+    return 2;
+  }
+
+  if (!warmStartPath.empty() && (!batchPath.empty() || nStreams > 1 || isMultipath)) {
+    std::cerr << "ERROR: --warm-start cannot be combined with --batch, --streams, or multiple --fwhint\n";
+    return 2;
+  }
+
+  if (warmStartMaxAge <= 0) {
+    std::cerr << "ERROR: --warm-start-max-age must be positive\n";
+    return 2;
+  }
+
+  if (!resumePath.empty() && outputPath.empty()) {
+    std::cerr << "ERROR: --resume requires --output\n";
+    return 2;
+  }
+
+  if (nValidationThreads > 256) {
+    std::cerr << "ERROR: --validation-threads cannot be greater than 256\n";
+    return 2;
+  }
+
+  options.targetDelay = time::milliseconds(vm["target-delay"].as<time::milliseconds::rep>());
+  if (options.targetDelay <= 0_ms) {
+    std::cerr << "ERROR: --target-delay must be positive\n";
+    return 2;
+  }
+
   if (rttEstOptions->k < 0) {
     std::cerr << "ERROR: --rto-k cannot be negative\n";
     return 2;
@@ -231,17 +518,34 @@ main(int argc, char* argv[])
 
   try {
     Face face;
-    auto discover = std::make_unique<DiscoverVersion>(face, Name(prefix), options);
-    std::unique_ptr<PipelineInterests> pipeline;
-    std::unique_ptr<StatisticsCollector> statsCollector;
-    std::unique_ptr<RttEstimatorWithStats> rttEstimator;
-    std::ofstream statsFileCwnd;
-    std::ofstream statsFileRtt;
 
-    if (pipelineType == "fixed") {
-      pipeline = std::make_unique<PipelineInterestsFixed>(face, options);
+    std::unique_ptr<WarmStartCache> warmStartCache;
+    const WarmStartCache::Entry* warmStartEntry = nullptr;
+    if (!warmStartPath.empty()) {
+      // the cache is only a hint, a transfer can always start cold
+      try {
+        warmStartCache = std::make_unique<WarmStartCache>(warmStartPath);
+        if (warmStartCache->getNSkippedLines() > 0 && !options.isQuiet) {
+          std::cerr << "WARNING: skipped " << warmStartCache->getNSkippedLines()
+                    << " malformed line(s) in '" << warmStartPath << "'\n";
+        }
+      }
+      catch (const WarmStartCache::Error& e) {
+        if (!options.isQuiet) {
+          std::cerr << "WARNING: " << e.what() << ", starting cold\n";
+        }
+      }
+      if (warmStartCache != nullptr) {
+        auto routablePrefix = WarmStartCache::getRoutablePrefix(Name(prefix), options.forwardingHint);
+        warmStartEntry = warmStartCache->find(routablePrefix, time::seconds(warmStartMaxAge));
+        if (warmStartEntry != nullptr) {
+          rttEstOptions->initialRto = WarmStartCache::getInitialRto(*warmStartEntry, *rttEstOptions);
+        }
+      }
     }
-    else if (pipelineType == "aimd" || pipelineType == "cubic") {
+
+    std::unique_ptr<RttEstimatorWithStats> rttEstimator;
+    if (pipelineType != "fixed") {
       if (options.isVerbose) {
         using namespace ndn::time;
         std::cerr << "RTT estimator parameters:\n"
@@ -253,46 +557,257 @@ main(int argc, char* argv[])
                   << "\tMax RTO = " << duration_cast<milliseconds>(rttEstOptions->maxRto) << "\n"
                   << "\tBackoff multiplier = " << rttEstOptions->rtoBackoffMultiplier << "\n";
       }
-      rttEstimator = std::make_unique<RttEstimatorWithStats>(std::move(rttEstOptions));
+      rttEstimator = std::make_unique<RttEstimatorWithStats>(rttEstOptions);
+    }
 
-      std::unique_ptr<PipelineInterestsAdaptive> adaptivePipeline;
-      if (pipelineType == "aimd") {
-        adaptivePipeline = std::make_unique<PipelineInterestsAimd>(face, *rttEstimator, options);
-      }
-      else {
-        adaptivePipeline = std::make_unique<PipelineInterestsCubic>(face, *rttEstimator, options);
-      }
+    std::unique_ptr<ValidationPool> validationPool;
+    if (nValidationThreads > 0) {
+      validationPool = std::make_unique<ValidationPool>(face.getIoContext(), nValidationThreads, [] {
+        return std::make_unique<security::ValidatorNull>();
+      });
+    }
 
-      if (!cwndPath.empty() || !rttPath.empty()) {
-        if (!cwndPath.empty()) {
-          statsFileCwnd.open(cwndPath);
-          if (statsFileCwnd.fail()) {
-            std::cerr << "ERROR: failed to open '" << cwndPath << "'\n";
-            return 4;
-          }
+    if (!batchPath.empty()) {
+      std::vector<BatchFetcher::Item> items;
+      try {
+        if (batchPath == "-") {
+          items = BatchFetcher::parseList(std::cin, outputPath);
         }
-        if (!rttPath.empty()) {
-          statsFileRtt.open(rttPath);
-          if (statsFileRtt.fail()) {
-            std::cerr << "ERROR: failed to open '" << rttPath << "'\n";
+        else {
+          std::ifstream batchFile(batchPath);
+          if (batchFile.fail()) {
+            std::cerr << "ERROR: failed to open '" << batchPath << "'\n";
             return 4;
           }
+          items = BatchFetcher::parseList(batchFile, outputPath);
         }
-        statsCollector = std::make_unique<StatisticsCollector>(*adaptivePipeline, statsFileCwnd, statsFileRtt);
       }
+      catch (const BatchFetcher::Error& e) {
+        std::cerr << "ERROR: " << batchPath << ": " << e.what() << "\n";
+        return 2;
+      }
+
+      // the summary of each transfer is only printed in verbose mode
+      Options pipelineOptions = options;
+      pipelineOptions.isQuiet = !options.isVerbose;
+
+      // the RTT estimator belongs to the transfer, or is shared by the concurrent transfers
+      BatchFetcher fetcher(face, security::getAcceptAllValidator(), options,
+        [&] (RttEstimatorWithStats& transferRttEstimator) {
+          return makePipeline(pipelineType, face, &transferRttEstimator, pipelineOptions);
+        }, maxConcurrent, rttEstOptions);
+      if (validationPool != nullptr) {
+        fetcher.setValidationPool(*validationPool);
+      }
+      fetcher.run(std::move(items));
+      face.processEvents();
 
-      pipeline = std::move(adaptivePipeline);
+      if (!options.isQuiet) {
+        fetcher.printSummary();
+      }
+      return fetcher.getNFailed() > 0 ? 1 : 0;
+    }
+
+    Name name(prefix);
+    std::unique_ptr<ResumeState> resumeState;
+    if (!resumePath.empty()) {
+      try {
+        resumeState = std::make_unique<ResumeState>(resumePath);
+      }
+      catch (const ResumeState::Error& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 4;
+      }
+
+      if (resumeState->hasLayout()) {
+        if (!name.isPrefixOf(resumeState->getVersionedName())) {
+          std::cerr << "ERROR: '" << resumePath << "' belongs to the transfer of "
+                    << resumeState->getVersionedName() << "\n";
+          return 2;
+        }
+        // continue with the same version, the segments on disk belong to it
+        name = resumeState->getVersionedName();
+        options.disableVersionDiscovery = true;
+      }
+    }
+
+    auto discover = std::make_unique<DiscoverVersion>(face, name, options);
+    std::unique_ptr<StatisticsCollector> statsCollector;
+    std::ofstream statsFileCwnd;
+    std::ofstream statsFileRtt;
+    std::ofstream statsFile;
+
+    std::unique_ptr<PipelineInterests> pipeline;
+    if (isMultipath) {
+      pipeline = std::make_unique<PipelineInterestsMultipath>(face, options, rttEstOptions,
+        [&] (RttEstimatorWithStats& pathRttEstimator, const Options& pathOptions) {
+          return makeAdaptivePipeline(pipelineType, face, pathRttEstimator, pathOptions);
+        });
+    }
+    else if (nStreams > 1) {
+      pipeline = std::make_unique<PipelineInterestsStriped>(face, options, nStreams, rttEstOptions,
+        [&] (RttEstimatorWithStats& streamRttEstimator, const Options& streamOptions) {
+          return makeAdaptivePipeline(pipelineType, face, streamRttEstimator, streamOptions);
+        });
     }
     else {
-      std::cerr << "ERROR: '" << pipelineType << "' is not a valid pipeline type\n";
-      return 2;
+      pipeline = makePipeline(pipelineType, face, rttEstimator.get(), options);
+    }
+    auto adaptivePipeline = dynamic_cast<PipelineInterestsAdaptive*>(pipeline.get());
+    if (warmStartEntry != nullptr) {
+      BOOST_ASSERT(adaptivePipeline != nullptr);
+      auto window = WarmStartCache::getInitialWindow(*warmStartEntry, options.initCwnd);
+      adaptivePipeline->setWindowState(window);
+      if (options.isVerbose) {
+        using namespace ndn::time;
+        std::cerr << "Warm start from the transfer of "
+                  << duration_cast<seconds>(system_clock::now() - warmStartEntry->timestamp) << " ago:\n"
+                  << "\tSmoothed RTT = " << duration_cast<milliseconds>(warmStartEntry->sRtt) << "\n"
+                  << "\tRTT variation = " << duration_cast<milliseconds>(warmStartEntry->rttVar) << "\n"
+                  << "\tInitial RTO = " << duration_cast<milliseconds>(rttEstOptions->initialRto) << "\n"
+                  << "\tInitial congestion window size = " << window.cwnd << "\n"
+                  << "\tInitial slow start threshold = " << window.ssthresh << "\n";
+      }
+    }
+    if (adaptivePipeline != nullptr && (!cwndPath.empty() || !rttPath.empty())) {
+      if (!cwndPath.empty()) {
+        statsFileCwnd.open(cwndPath);
+        if (statsFileCwnd.fail()) {
+          std::cerr << "ERROR: failed to open '" << cwndPath << "'\n";
+          return 4;
+        }
+      }
+      if (!rttPath.empty()) {
+        statsFileRtt.open(rttPath);
+        if (statsFileRtt.fail()) {
+          std::cerr << "ERROR: failed to open '" << rttPath << "'\n";
+          return 4;
+        }
+      }
+      statsCollector = std::make_unique<StatisticsCollector>(*adaptivePipeline, statsFileCwnd, statsFileRtt);
+    }
+
+    if (!statsPath.empty()) {
+      BOOST_ASSERT(adaptivePipeline != nullptr);
+      statsFile.open(statsPath);
+      if (statsFile.fail()) {
+        std::cerr << "ERROR: failed to open '" << statsPath << "'\n";
+        return 4;
+      }
+    }
+
+    std::ofstream reportFile;
+    if (!reportPath.empty()) {
+      reportFile.open(reportPath);
+      if (reportFile.fail()) {
+        std::cerr << "ERROR: failed to open '" << reportPath << "'\n";
+        return 4;
+      }
+    }
+
+    std::unique_ptr<FileWriter> fileWriter;
+    std::unique_ptr<VectoredWriter> stdoutWriter;
+    std::unique_ptr<Consumer> consumer;
+    // declared after the consumer, so that it is destroyed first: it queries the backlog of the
+    // consumer and is connected to the signals of the pipeline owned by the consumer
+    std::unique_ptr<StatisticsSampler> statsSampler;
+    if (!outputPath.empty()) {
+      try {
+        // keep the segments written by the interrupted transfer, if any
+        bool isResuming = resumeState != nullptr && resumeState->hasLayout();
+        fileWriter = std::make_unique<FileWriter>(outputPath, !isResuming);
+      }
+      catch (const FileWriter::Error& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 4;
+      }
+      consumer = std::make_unique<Consumer>(security::getAcceptAllValidator(), *fileWriter);
+      if (resumeState != nullptr) {
+        consumer->setResumeState(*resumeState);
+      }
+    }
+    else {
+      stdoutWriter = std::make_unique<VectoredWriter>(STDOUT_FILENO, face.getIoContext());
+      consumer = std::make_unique<Consumer>(security::getAcceptAllValidator(), *stdoutWriter);
+    }
+
+    if (validationPool != nullptr) {
+      consumer->setValidationPool(*validationPool);
+    }
+
+    if (statsFile.is_open()) {
+      statsSampler = std::make_unique<StatisticsSampler>(face, *adaptivePipeline, statsInterval, statsFile,
+                                                         [&consumer] { return consumer->getBacklog(); });
     }
 
-    Consumer consumer(security::getAcceptAllValidator());
     BOOST_ASSERT(discover != nullptr);
     BOOST_ASSERT(pipeline != nullptr);
-    consumer.run(std::move(discover), std::move(pipeline));
-    face.processEvents();
+    consumer->run(std::move(discover), std::move(pipeline));
+
+    // written even if the transfer fails, in which case `error` is its reason
+    auto writeReport = [&] (const std::string& error) {
+      JsonWriter json(reportFile);
+      json.beginObject()
+          .member("schemaVersion", 1)
+          .member("name", name.toUri())
+          .member("success", error.empty());
+      if (error.empty()) {
+        json.member("error", nullptr);
+      }
+      else {
+        json.member("error", error);
+      }
+      json.beginObject("options");
+      writeOptionsReport(json, pipelineType, nStreams, options, *rttEstOptions);
+      json.endObject();
+      consumer->writeReport(json);
+      json.endObject();
+      reportFile.close();
+    };
+
+    try {
+      face.processEvents();
+      if (fileWriter != nullptr && !consumer->hasWrittenAllSegments()) {
+        // e.g., the pipeline stopped requesting segments before learning the last one
+        NDN_THROW(std::runtime_error("The transfer ended before all segments were written to '" +
+                                     outputPath + "'"));
+      }
+    }
+    catch (const std::exception& e) {
+      if (reportFile.is_open()) {
+        writeReport(e.what());
+      }
+      throw;
+    }
+
+    if (!options.isQuiet) {
+      consumer->printSummary();
+    }
+
+    if (reportFile.is_open()) {
+      writeReport("");
+      if (reportFile.fail()) {
+        std::cerr << "ERROR: failed to write '" << reportPath << "'\n";
+        return 4;
+      }
+    }
+
+    // only record the state of a path on which at least one RTT has been measured
+    if (warmStartCache != nullptr && rttEstimator->getMinRtt() != time::nanoseconds::max()) {
+      auto window = adaptivePipeline->getWindowState();
+      warmStartCache->insert(WarmStartCache::getRoutablePrefix(Name(prefix), options.forwardingHint),
+                             {time::system_clock::now(), rttEstimator->getSmoothedRtt(),
+                              rttEstimator->getRttVariation(), window.cwnd, window.ssthresh});
+      try {
+        warmStartCache->save(time::seconds(warmStartMaxAge));
+      }
+      catch (const WarmStartCache::Error& e) {
+        // the transfer itself succeeded, the cache is only a hint for the next ones
+        if (!options.isQuiet) {
+          std::cerr << "WARNING: " << e.what() << "\n";
+        }
+      }
+    }
   }
   catch (const Consumer::ApplicationNackError& e) {
     std::cerr << "ERROR: " << e.what() << "\n";
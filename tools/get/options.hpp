@@ -31,6 +31,7 @@
 #include <ndn-cxx/util/time.hpp>
 
 #include <limits>
+#include <vector>
 
 namespace ndn::get {
 
@@ -40,9 +41,13 @@ struct Options
   time::milliseconds interestLifetime = DEFAULT_INTEREST_LIFETIME;
   int maxRetriesOnTimeoutOrNack = 15;
   bool disableVersionDiscovery = false;
+  bool enableVersionProbe = false; ///< race the discovery Interest with a CanBePrefix Interest
   bool mustBeFresh = false;
   bool isQuiet = false;
   bool isVerbose = false;
+  size_t maxBufferSize = 0;     ///< max # of out-of-order segments held by the consumer (0 = unlimited)
+  bool probeFinalBlockId = false; ///< limit the segments requested until the last one is known
+  std::vector<Name> forwardingHint; ///< ForwardingHint of all Interests (empty = none)
 
   // Fixed pipeline options
   size_t maxPipelineSize = 1;
@@ -50,9 +55,15 @@ struct Options
   // Adaptive pipeline common options
   double initCwnd = 2.0;        ///< initial congestion window size
   double initSsthresh = std::numeric_limits<double>::max(); ///< initial slow start threshold
-  time::milliseconds rtoCheckInterval{10}; ///< interval for checking retransmission timer
   bool ignoreCongMarks = false; ///< disable window decrease after receiving congestion mark
   bool disableCwa = false;      ///< disable conservative window adaptation
+  bool enablePacing = false;    ///< spread the Interests of a window over the smoothed RTT
+  bool enableDctcp = false;     ///< decrease the window in proportion to the fraction of marked packets
+  bool enableFastRetx = false;  ///< retransmit missing segments without waiting for their RTO
+  bool enableAdaptiveLifetime = false; ///< set the lifetime of each Interest to its RTO plus a margin,
+                                       ///< between minLifetime and interestLifetime
+  time::milliseconds minLifetime = 200_ms;    ///< lower bound of the adaptive Interest lifetime
+  time::milliseconds lifetimeMargin = 100_ms; ///< added to the RTO to obtain the adaptive lifetime
 
   // AIMD pipeline options
   double aiStep = 1.0;          ///< AIMD additive increase step (in segments)
@@ -62,6 +73,10 @@ struct Options
   // Cubic pipeline options
   double cubicBeta = 0.7;       ///< cubic multiplicative decrease factor
   bool enableFastConv = false;  ///< use cubic fast convergence
+  bool disableHystart = false;  ///< do not use HyStart to end slow start before the first loss
+
+  // LEDBAT pipeline options
+  time::milliseconds targetDelay = 100_ms; ///< target queueing delay
 };
 
 } // namespace ndn::get
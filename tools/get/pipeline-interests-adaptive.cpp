@@ -30,11 +30,21 @@
 #include "data-fetcher.hpp"
 
 #include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 
 namespace ndn::get {
 
+/// Maximum amount of sending opportunities that the pacer accumulates while the pipeline is idle.
+constexpr time::nanoseconds MAX_PACING_CREDIT = 1_ms;
+
+/// Weight of the latest window in the moving average of the marking fraction (RFC 8257).
+constexpr double DCTCP_G = 1.0 / 16.0;
+
 PipelineInterestsAdaptive::PipelineInterestsAdaptive(Face& face,
                                                      RttEstimatorWithStats& rttEstimator,
                                                      const Options& opts)
@@ -48,12 +58,61 @@ PipelineInterestsAdaptive::PipelineInterestsAdaptive(Face& face,
 
 PipelineInterestsAdaptive::~PipelineInterestsAdaptive()
 {
-  cancel();
+  // unlike cancel(), do not emit afterCancel, whose handlers may refer to objects that
+  // are destroyed together with the pipeline
+  stopFetching();
+}
+
+void
+PipelineInterestsAdaptive::setWindowState(const WindowState& state)
+{
+  m_cwnd = std::max(state.cwnd, MIN_SSTHRESH);
+  m_ssthresh = std::max(state.ssthresh, MIN_SSTHRESH);
+}
+
+void
+PipelineInterestsAdaptive::shareWindowOf(PipelineInterestsAdaptive& owner)
+{
+  BOOST_ASSERT(&owner.m_rttEstimator == &m_rttEstimator);
+  BOOST_ASSERT(owner.m_windowOwner == &owner);
+  m_windowOwner = &owner;
+}
+
+void
+PipelineInterestsAdaptive::setLastSegmentNo(uint64_t lastSegmentNo)
+{
+  if (isStopping() || m_hasFinalBlockId)
+    return;
+
+  if (!handleFinalBlockId(lastSegmentNo))
+    return;
+
+  if (allSegmentsReceived()) {
+    cancel();
+    if (!m_options.isQuiet) {
+      printSummary();
+    }
+  }
+  else {
+    schedulePackets();
+  }
+}
+
+void
+PipelineInterestsAdaptive::sendPendingInterests()
+{
+  if (isStopping())
+    return;
+
+  schedulePackets();
 }
 
 void
 PipelineInterestsAdaptive::doRun()
 {
+  m_segmentTable.setStride(getStripeCount());
+  m_lossScanSegNo = getStripeIndex();
+
   if (allSegmentsReceived()) {
     cancel();
     if (!m_options.isQuiet) {
@@ -62,48 +121,97 @@ PipelineInterestsAdaptive::doRun()
     return;
   }
 
-  // schedule the event to check retransmission timer
-  m_checkRtoEvent = m_scheduler.schedule(m_options.rtoCheckInterval, [this] { checkRto(); });
-
+  if (m_windowOwner != this) {
+    m_windowOwner->m_windowSharers.push_back(this);
+  }
   schedulePackets();
+
+  // like the later ones, the first observation window covers the Interests sent when it starts
+  // (WindowEnd = SND.NXT in RFC 8257), instead of ending with the first Data packet
+  m_markWindowEnd = m_highInterest + 1;
 }
 
 void
 PipelineInterestsAdaptive::doCancel()
+{
+  stopFetching();
+  afterCancel();
+}
+
+void
+PipelineInterestsAdaptive::stopFetching()
 {
   m_checkRtoEvent.cancel();
-  m_segmentInfo.clear();
+  m_pacingEvent.cancel();
+  m_checkRtoDeadline = time::steady_clock::time_point::max();
+  m_rtoTimers = {};
+  m_segmentTable.clear();
+
+  auto& sharers = m_windowOwner->m_windowSharers;
+  auto it = std::find(sharers.begin(), sharers.end(), this);
+  if (it != sharers.end()) {
+    // the share of this pipeline can be used by the others
+    sharers.erase(it);
+    m_windowOwner->wakeWindowSharers();
+  }
+}
+
+void
+PipelineInterestsAdaptive::doResume()
+{
+  schedulePackets();
 }
 
 void
 PipelineInterestsAdaptive::checkRto()
 {
+  m_checkRtoDeadline = time::steady_clock::time_point::max();
+
   if (isStopping())
     return;
 
   bool hasTimeout = false;
   uint64_t highTimeoutSeg = 0;
-
-  for (auto& entry : m_segmentInfo) {
-    SegmentInfo& segInfo = entry.second;
-    if (segInfo.state != SegmentState::InRetxQueue) { // skip segments already in the retx queue
-      auto timeElapsed = time::steady_clock::now() - segInfo.timeSent;
-      if (timeElapsed > segInfo.rto) { // timer expired?
-        m_nTimeouts++;
-        hasTimeout = true;
-        highTimeoutSeg = std::max(highTimeoutSeg, entry.first);
-        enqueueForRetransmission(entry.first);
-      }
+  auto now = time::steady_clock::now();
+
+  while (!m_rtoTimers.empty() && m_rtoTimers.top().deadline <= now) {
+    RtoTimer timer = m_rtoTimers.top();
+    m_rtoTimers.pop();
+
+    // the timer is stale if the segment has been received, is already in the retx queue,
+    // or has been retransmitted since the timer was started
+    const SegmentInfo* segInfo = m_segmentTable.find(timer.segNo);
+    if (segInfo == nullptr ||
+        segInfo->state == SegmentState::InRetxQueue ||
+        segInfo->timeSent + segInfo->rto != timer.deadline) {
+      continue;
     }
+
+    m_nTimeouts++;
+    hasTimeout = true;
+    highTimeoutSeg = std::max(highTimeoutSeg, timer.segNo);
+    enqueueForRetransmission(timer.segNo);
   }
 
   if (hasTimeout) {
     recordTimeout(highTimeoutSeg);
     schedulePackets();
+    m_windowOwner->wakeWindowSharers();
+  }
+
+  armRtoTimer();
+}
+
+void
+PipelineInterestsAdaptive::armRtoTimer()
+{
+  if (m_rtoTimers.empty() || m_rtoTimers.top().deadline >= m_checkRtoDeadline) {
+    return; // nothing to wait for, or the event is already due early enough
   }
 
-  // schedule the next check after predefined interval
-  m_checkRtoEvent = m_scheduler.schedule(m_options.rtoCheckInterval, [this] { checkRto(); });
+  m_checkRtoDeadline = m_rtoTimers.top().deadline;
+  auto delay = std::max<time::nanoseconds>(m_checkRtoDeadline - time::steady_clock::now(), 0_ns);
+  m_checkRtoEvent = m_scheduler.schedule(delay, [this] { checkRto(); });
 }
 
 void
@@ -123,13 +231,14 @@ PipelineInterestsAdaptive::sendInterest(uint64_t segNo, bool isRetransmission)
               << " segment #" << segNo << "\n";
   }
 
+  SegmentInfo& segInfo = m_segmentTable.insert(segNo);
+
   if (isRetransmission) {
     // keep track of retx count for this segment
-    auto ret = m_retxCount.emplace(segNo, 1);
-    if (!ret.second) { // not the first retransmission
-      m_retxCount[segNo] += 1;
+    segInfo.retxCount++;
+    if (segInfo.retxCount > 1) { // not the first retransmission
       if (m_options.maxRetriesOnTimeoutOrNack != DataFetcher::MAX_RETRIES_INFINITE &&
-          m_retxCount[segNo] > m_options.maxRetriesOnTimeoutOrNack) {
+          segInfo.retxCount > m_options.maxRetriesOnTimeoutOrNack) {
         return handleFail(segNo, "Reached the maximum number of retries (" +
                           std::to_string(m_options.maxRetriesOnTimeoutOrNack) +
                           ") while retrieving segment #" + std::to_string(segNo));
@@ -137,23 +246,28 @@ PipelineInterestsAdaptive::sendInterest(uint64_t segNo, bool isRetransmission)
 
       if (m_options.isVerbose) {
         std::cerr << "# of retries for segment #" << segNo
-                  << " is " << m_retxCount[segNo] << "\n";
+                  << " is " << segInfo.retxCount << "\n";
       }
     }
   }
 
-  auto interest = Interest()
-                  .setName(Name(m_prefix).appendSegment(segNo))
-                  .setMustBeFresh(m_options.mustBeFresh)
-                  .setInterestLifetime(m_options.interestLifetime);
+  auto now = time::steady_clock::now();
+  if (isRetransmission && now < segInfo.timeSent + segInfo.lifetime) {
+    // the previous Interest is still pending in the forwarders
+    m_nRacingRetx++;
+  }
+
+  segInfo.rto = m_rttEstimator.getEstimatedRto();
+  segInfo.lifetime = getInterestLifetime(segInfo.rto);
+  auto interest = makeInterest(segNo, segInfo.lifetime);
 
-  SegmentInfo& segInfo = m_segmentInfo[segNo];
   segInfo.interestHdl = m_face.expressInterest(interest,
                                                FORWARD_TO_MEM_FN(handleData),
                                                FORWARD_TO_MEM_FN(handleNack),
                                                FORWARD_TO_MEM_FN(handleLifetimeExpiration));
-  segInfo.timeSent = time::steady_clock::now();
-  segInfo.rto = m_rttEstimator.getEstimatedRto();
+  segInfo.timeSent = now;
+  m_rtoTimers.push({segInfo.timeSent + segInfo.rto, segNo});
+  armRtoTimer();
 
   m_nInFlight++;
   m_nSent++;
@@ -172,24 +286,131 @@ void
 PipelineInterestsAdaptive::schedulePackets()
 {
   BOOST_ASSERT(m_nInFlight >= 0);
-  auto availableWindowSize = static_cast<int64_t>(m_cwnd) - m_nInFlight;
+  auto availableWindowSize = getAvailableWindowSize();
+
+  time::nanoseconds pacingInterval = 0_ns;
+  auto now = time::steady_clock::now();
+  double pacingRate = getPacingRate();
+  if (pacingRate > 0.0) {
+    pacingInterval = time::nanoseconds(static_cast<time::nanoseconds::rep>(1e9 / pacingRate));
+    m_nextSendTime = std::max(m_nextSendTime, now - MAX_PACING_CREDIT);
+  }
 
   while (availableWindowSize > 0) {
+    if (pacingInterval > 0_ns && m_nextSendTime > now) {
+      // come back when the pacer allows the next Interest to be sent
+      m_pacingEvent = m_scheduler.schedule(m_nextSendTime - now, [this] { schedulePackets(); });
+      break;
+    }
+
     if (!m_retxQueue.empty()) { // do retransmission first
       uint64_t retxSegNo = m_retxQueue.front();
       m_retxQueue.pop();
-      if (m_segmentInfo.count(retxSegNo) == 0) {
+      if (m_segmentTable.find(retxSegNo) == nullptr) {
         m_nSkippedRetx++;
         continue;
       }
-      // the segment is still in the map, that means it needs to be retransmitted
+      // the segment is still in the table, that means it needs to be retransmitted
       sendInterest(retxSegNo, true);
     }
+    else if (m_segmentQueue != nullptr && retransmitLostSegment()) {
+      // a segment lost on another path has been retransmitted
+    }
     else { // send next segment
-      sendInterest(getNextSegmentNo(), false);
+      if (!canRequestNewSegment()) {
+        break; // the consumer's reorder buffer is full
+      }
+      sendInterest(m_segmentQueue != nullptr ? m_segmentQueue->getNextSegmentNo() : getNextSegmentNo(),
+                   false);
     }
     availableWindowSize--;
+    m_nextSendTime += pacingInterval;
+  }
+}
+
+int64_t
+PipelineInterestsAdaptive::getAvailableWindowSize() const
+{
+  if (!isWindowShared()) {
+    return static_cast<int64_t>(m_cwnd) - m_nInFlight;
+  }
+
+  // stay within both the room left in the shared window and the share of this pipeline
+  const auto& owner = *m_windowOwner;
+  int64_t nGroupInFlight = 0;
+  for (const auto* sharer : owner.m_windowSharers) {
+    nGroupInFlight += sharer->m_nInFlight;
+  }
+  auto groupRoom = static_cast<int64_t>(owner.m_cwnd) - nGroupInFlight;
+  auto shareRoom = static_cast<int64_t>(std::ceil(getWindowShare())) - m_nInFlight;
+  return std::min(groupRoom, shareRoom);
+}
+
+double
+PipelineInterestsAdaptive::getWindowShare() const
+{
+  const auto& owner = *m_windowOwner;
+  auto nSharers = std::max<size_t>(owner.m_windowSharers.size(), 1);
+  return owner.m_cwnd / static_cast<double>(nSharers);
+}
+
+void
+PipelineInterestsAdaptive::wakeWindowSharers()
+{
+  if (m_isWakeUpPending || m_windowSharers.empty())
+    return;
+
+  // the calling pipeline is still processing its event, so wake up the others later
+  m_isWakeUpPending = true;
+  post([this] {
+    m_isWakeUpPending = false;
+    // sending Interests may stop a pipeline, which then leaves the group
+    auto sharers = m_windowSharers;
+    for (auto* sharer : sharers) {
+      if (std::find(m_windowSharers.begin(), m_windowSharers.end(), sharer) != m_windowSharers.end()) {
+        sharer->sendPendingInterests();
+      }
+    }
+  });
+}
+
+bool
+PipelineInterestsAdaptive::retransmitLostSegment()
+{
+  while (auto lost = m_segmentQueue->popLost(m_pathId)) {
+    if (m_hasFinalBlockId && lost->segNo > m_lastSegmentNo) {
+      continue; // not part of the content
+    }
+    m_segmentTable.insert(lost->segNo).retxCount = lost->retxCount;
+    sendInterest(lost->segNo, true);
+    return true;
+  }
+  return false;
+}
+
+time::milliseconds
+PipelineInterestsAdaptive::getInterestLifetime(time::nanoseconds rto) const
+{
+  if (!m_options.enableAdaptiveLifetime) {
+    return m_options.interestLifetime;
+  }
+
+  auto lifetime = time::duration_cast<time::milliseconds>(rto + m_options.lifetimeMargin);
+  return std::clamp(lifetime, m_options.minLifetime, m_options.interestLifetime);
+}
+
+double
+PipelineInterestsAdaptive::getPacingRate() const
+{
+  if (!m_options.enablePacing || m_rttEstimator.getMinRtt() == time::nanoseconds::max()) {
+    return 0.0;
   }
+
+  auto sRtt = m_rttEstimator.getSmoothedRtt();
+  if (sRtt <= 0_ns) {
+    return 0.0;
+  }
+  return getWindowShare() / (sRtt.count() / 1e9);
 }
 
 void
@@ -201,26 +422,18 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
   // Interest was expressed with CanBePrefix=false
   BOOST_ASSERT(data.getName().equals(interest.getName()));
 
-  if (!m_hasFinalBlockId && data.getFinalBlock()) {
-    m_lastSegmentNo = data.getFinalBlock()->toSegment();
-    m_hasFinalBlockId = true;
-    cancelInFlightSegmentsGreaterThan(m_lastSegmentNo);
-    if (m_hasFailure && m_lastSegmentNo >= m_failedSegNo) {
-      // previously failed segment is part of the content
-      return onFailure(m_failureReason);
-    }
-    else {
-      m_hasFailure = false;
-    }
+  if (!m_hasFinalBlockId && data.getFinalBlock() &&
+      !handleFinalBlockId(data.getFinalBlock()->toSegment())) {
+    return;
   }
 
   uint64_t recvSegNo = getSegmentFromPacket(data);
-  auto segIt = m_segmentInfo.find(recvSegNo);
-  if (segIt == m_segmentInfo.end()) {
+  SegmentInfo* segInfoPtr = m_segmentTable.find(recvSegNo);
+  if (segInfoPtr == nullptr) {
     return; // ignore already-received segment
   }
 
-  SegmentInfo& segInfo = segIt->second;
+  SegmentInfo& segInfo = *segInfoPtr;
   time::nanoseconds rtt = time::steady_clock::now() - segInfo.timeSent;
   if (m_options.isVerbose) {
     std::cerr << "Received segment #" << recvSegNo
@@ -229,6 +442,7 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
   }
 
   m_highData = std::max(m_highData, recvSegNo);
+  auto& window = *m_windowOwner;
 
   // for segments in retx queue, we must not decrement m_nInFlight
   // because it was already decremented when the segment timed out
@@ -236,29 +450,39 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
     m_nInFlight--;
   }
 
+  window.handleAckedData();
+
   // upon finding congestion mark, decrease the window size
   // without retransmitting any packet
-  if (data.getCongestionMark() > 0) {
+  bool isMarked = data.getCongestionMark() > 0;
+  if (isMarked) {
     m_nCongMarks++;
     if (!m_options.ignoreCongMarks) {
-      if (m_options.disableCwa || m_highData > m_recPoint) {
+      if (m_options.enableDctcp) {
+        // the window is decreased at the end of the observation window
+      }
+      else if (m_options.disableCwa || m_highData > m_recPoint) {
         m_recPoint = m_highInterest;  // react to only one congestion event (timeout or congestion mark)
                                       // per RTT (conservative window adaptation)
         m_nMarkDecr++;
-        decreaseWindow();
+        window.decreaseWindow();
 
         if (m_options.isVerbose) {
           std::cerr << "Received congestion mark, value = " << data.getCongestionMark()
-                    << ", new cwnd = " << m_cwnd << "\n";
+                    << ", new cwnd = " << window.m_cwnd << "\n";
         }
       }
     }
     else {
-      increaseWindow();
+      window.increaseWindow();
     }
   }
   else {
-    increaseWindow();
+    window.increaseWindow();
+  }
+
+  if (m_options.enableDctcp && !m_options.ignoreCongMarks) {
+    updateMarkingFraction(recvSegNo, isMarked);
   }
 
   onData(data);
@@ -266,18 +490,27 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
   // do not sample RTT for retransmitted segments
   if ((segInfo.state == SegmentState::FirstTimeSent ||
        segInfo.state == SegmentState::InRetxQueue) &&
-      m_retxCount.count(recvSegNo) == 0) {
+      segInfo.retxCount == 0) {
     auto nExpectedSamples = std::max<int64_t>((m_nInFlight + 1) >> 1, 1);
     BOOST_ASSERT(nExpectedSamples > 0);
     m_rttEstimator.addMeasurement(rtt, static_cast<size_t>(nExpectedSamples));
-    afterRttMeasurement({recvSegNo, rtt,
-                         m_rttEstimator.getSmoothedRtt(),
-                         m_rttEstimator.getRttVariation(),
-                         m_rttEstimator.getEstimatedRto()});
+    m_rttHistogram.add(rtt);
+    RttSample sample{recvSegNo, rtt,
+                     m_rttEstimator.getSmoothedRtt(),
+                     m_rttEstimator.getRttVariation(),
+                     m_rttEstimator.getEstimatedRto()};
+    afterRttMeasurement(sample);
+    if (&window != this) {
+      window.afterRttMeasurement(sample);
+    }
   }
 
   // remove the entry associated with the received segment
-  m_segmentInfo.erase(segIt);
+  m_segmentTable.erase(recvSegNo);
+
+  if (m_options.enableFastRetx) {
+    detectLosses();
+  }
 
   if (allSegmentsReceived()) {
     cancel();
@@ -287,6 +520,7 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
   }
   else {
     schedulePackets();
+    window.wakeWindowSharers();
   }
 }
 
@@ -311,8 +545,16 @@ PipelineInterestsAdaptive::handleNack(const Interest& interest, const lp::Nack&
       enqueueForRetransmission(segNo);
       recordTimeout(segNo);
       schedulePackets();
+      m_windowOwner->wakeWindowSharers();
       break;
     default:
+      if (m_segmentQueue != nullptr) {
+        // this path may be unusable, let another one retrieve the segment
+        enqueueForRetransmission(segNo);
+        recordTimeout(segNo);
+        schedulePackets();
+        break;
+      }
       handleFail(segNo, "Could not retrieve data for " + interest.getName().toUri() +
                  ", reason: " + boost::lexical_cast<std::string>(nack.getReason()));
       break;
@@ -325,30 +567,72 @@ PipelineInterestsAdaptive::handleLifetimeExpiration(const Interest& interest)
   if (isStopping())
     return;
 
-  m_nTimeouts++;
-
+  // as in checkRto(), ignore a segment that has already been received or is already waiting
+  // for retransmission, e.g., because its RTO expired before the Interest lifetime
   uint64_t segNo = getSegmentFromPacket(interest);
+  const SegmentInfo* segInfo = m_segmentTable.find(segNo);
+  if (segInfo == nullptr || segInfo->state == SegmentState::InRetxQueue) {
+    return;
+  }
+
+  m_nTimeouts++;
   enqueueForRetransmission(segNo);
   recordTimeout(segNo);
   schedulePackets();
+  m_windowOwner->wakeWindowSharers();
 }
 
 void
 PipelineInterestsAdaptive::recordTimeout(uint64_t segNo)
 {
-  if (m_options.disableCwa || segNo > m_recPoint) {
-    // interests that are still outstanding during a timeout event
-    // should not trigger another window decrease later (bug #5202)
-    m_recPoint = m_highInterest;
-
-    decreaseWindow();
+  if (recordLoss(segNo)) {
     m_rttEstimator.backoffRto();
-    m_nLossDecr++;
+  }
+}
+
+bool
+PipelineInterestsAdaptive::recordLoss(uint64_t segNo)
+{
+  if (!m_options.disableCwa && segNo <= m_recPoint) {
+    return false;
+  }
+
+  // interests that are still outstanding during a loss event
+  // should not trigger another window decrease later (bug #5202)
+  m_recPoint = m_highInterest;
+
+  m_windowOwner->decreaseWindow();
+  m_nLossDecr++;
+
+  if (m_options.isVerbose) {
+    std::cerr << "Packet loss event, new cwnd = " << m_windowOwner->m_cwnd
+              << ", ssthresh = " << m_windowOwner->m_ssthresh << "\n";
+  }
+  return true;
+}
+
+void
+PipelineInterestsAdaptive::detectLosses()
+{
+  uint64_t threshold = FAST_RETX_THRESHOLD * getStripeCount();
+  if (m_highData < threshold) {
+    return;
+  }
+
+  // a segment still waiting for its first Data packet is considered lost once enough segments
+  // that were requested after it have been received (forward acknowledgment)
+  for (; m_lossScanSegNo <= m_highData - threshold; m_lossScanSegNo += getStripeCount()) {
+    const SegmentInfo* segInfo = m_segmentTable.find(m_lossScanSegNo);
+    if (segInfo == nullptr || segInfo->state != SegmentState::FirstTimeSent) {
+      continue;
+    }
 
     if (m_options.isVerbose) {
-      std::cerr << "Packet loss event, new cwnd = " << m_cwnd
-                << ", ssthresh = " << m_ssthresh << "\n";
+      std::cerr << "Segment #" << m_lossScanSegNo << " is missing, fast retransmitting\n";
     }
+    m_nFastRetx++;
+    enqueueForRetransmission(m_lossScanSegNo);
+    recordLoss(m_lossScanSegNo);
   }
 }
 
@@ -357,8 +641,59 @@ PipelineInterestsAdaptive::enqueueForRetransmission(uint64_t segNo)
 {
   BOOST_ASSERT(m_nInFlight > 0);
   m_nInFlight--;
+  SegmentInfo* segInfo = m_segmentTable.find(segNo);
+  BOOST_ASSERT(segInfo != nullptr);
+
+  if (m_segmentQueue != nullptr) {
+    // hand the segment over to the other paths, cancelling the pending Interest on this one
+    int retxCount = segInfo->retxCount;
+    m_segmentTable.erase(segNo);
+    m_segmentQueue->pushLost(segNo, retxCount, m_pathId);
+    return;
+  }
+
   m_retxQueue.push(segNo);
-  m_segmentInfo.at(segNo).state = SegmentState::InRetxQueue;
+  segInfo->state = SegmentState::InRetxQueue;
+}
+
+void
+PipelineInterestsAdaptive::updateMarkingFraction(uint64_t segNo, bool isMarked)
+{
+  m_nAckedInWindow++;
+  if (isMarked) {
+    m_nMarkedInWindow++;
+  }
+
+  if (segNo < m_markWindowEnd) {
+    return;
+  }
+
+  // one window of data has been received since the last update
+  double fraction = static_cast<double>(m_nMarkedInWindow) / static_cast<double>(m_nAckedInWindow);
+  m_markingFraction = (1.0 - DCTCP_G) * m_markingFraction + DCTCP_G * fraction;
+  bool hasMarks = m_nMarkedInWindow > 0;
+  m_nAckedInWindow = 0;
+  m_nMarkedInWindow = 0;
+  m_markWindowEnd = m_highInterest + 1;
+
+  if (hasMarks) {
+    m_nMarkDecr++;
+    m_windowOwner->decreaseWindowProportionally(m_markingFraction);
+
+    if (m_options.isVerbose) {
+      std::cerr << "Congestion marks in the last window, marking fraction = " << m_markingFraction
+                << ", new cwnd = " << m_windowOwner->m_cwnd << "\n";
+    }
+  }
+}
+
+void
+PipelineInterestsAdaptive::decreaseWindowProportionally(double markingFraction)
+{
+  m_cwnd = std::max(MIN_SSTHRESH, m_cwnd * (1.0 - markingFraction / 2.0));
+  m_ssthresh = m_cwnd;
+
+  emitSignal(afterCwndChange, time::steady_clock::now() - getStartTime(), m_cwnd);
 }
 
 void
@@ -372,10 +707,10 @@ PipelineInterestsAdaptive::handleFail(uint64_t segNo, const std::string& reason)
     return onFailure(reason);
 
   if (!m_hasFinalBlockId) {
-    m_segmentInfo.erase(segNo);
+    m_segmentTable.erase(segNo);
     m_nInFlight--;
 
-    if (m_segmentInfo.empty()) {
+    if (m_segmentTable.empty()) {
       onFailure("Fetching terminated but no final segment number has been found");
     }
     else {
@@ -387,19 +722,26 @@ PipelineInterestsAdaptive::handleFail(uint64_t segNo, const std::string& reason)
   }
 }
 
+bool
+PipelineInterestsAdaptive::handleFinalBlockId(uint64_t lastSegmentNo)
+{
+  recordFinalBlockId(lastSegmentNo);
+  cancelInFlightSegmentsGreaterThan(m_lastSegmentNo);
+
+  if (m_hasFailure && m_lastSegmentNo >= m_failedSegNo) {
+    // previously failed segment is part of the content
+    onFailure(m_failureReason);
+    return false;
+  }
+  m_hasFailure = false;
+  return true;
+}
+
 void
 PipelineInterestsAdaptive::cancelInFlightSegmentsGreaterThan(uint64_t segNo)
 {
-  for (auto it = m_segmentInfo.begin(); it != m_segmentInfo.end();) {
-    // cancel fetching all segments that follow
-    if (it->first > segNo) {
-      it = m_segmentInfo.erase(it);
-      m_nInFlight--;
-    }
-    else {
-      ++it;
-    }
-  }
+  // cancel fetching all segments that follow
+  m_nInFlight -= static_cast<int64_t>(m_segmentTable.eraseGreaterThan(segNo));
 }
 
 void
@@ -411,11 +753,17 @@ PipelineInterestsAdaptive::printOptions() const
       << "\tInitial slow start threshold = " << m_options.initSsthresh << "\n"
       << "\tAdditive increase step = " << m_options.aiStep << "\n"
       << "\tMultiplicative decrease factor = " << m_options.mdCoef << "\n"
-      << "\tRTO check interval = " << m_options.rtoCheckInterval << "\n"
       << "\tReact to congestion marks = " << (m_options.ignoreCongMarks ? "no" : "yes") << "\n"
       << "\tConservative window adaptation = " << (m_options.disableCwa ? "no" : "yes") << "\n"
+      << "\tInterest pacing = " << (m_options.enablePacing ? "yes" : "no") << "\n"
+      << "\tProportional reaction to congestion marks = " << (m_options.enableDctcp ? "yes" : "no") << "\n"
+      << "\tFast retransmit = " << (m_options.enableFastRetx ? "yes" : "no") << "\n"
       << "\tResetting window to " << (m_options.resetCwndToInit ?
                                         "initial value" : "ssthresh") << " upon loss event\n";
+  if (m_options.enableAdaptiveLifetime) {
+    std::cerr << "\tAdaptive Interest lifetime = RTO + " << m_options.lifetimeMargin << ", between "
+              << m_options.minLifetime << " and " << m_options.interestLifetime << "\n";
+  }
 }
 
 void
@@ -426,8 +774,12 @@ PipelineInterestsAdaptive::printSummary() const
             << "Timeouts: " << m_nTimeouts << " (caused " << m_nLossDecr << " window decreases)\n"
             << "Retransmitted segments: " << m_nRetransmitted
             << " (" << (m_nSent == 0 ? 0 : (m_nRetransmitted * 100.0 / m_nSent)) << "%)"
-            << ", skipped: " << m_nSkippedRetx << "\n"
-            << "RTT ";
+            << ", skipped: " << m_nSkippedRetx
+            << ", racing a pending Interest: " << m_nRacingRetx << "\n";
+  if (m_options.enableFastRetx) {
+    std::cerr << "Fast retransmissions: " << m_nFastRetx << "\n";
+  }
+  std::cerr << "RTT ";
 
   if (m_rttEstimator.getMinRtt() == time::nanoseconds::max() ||
       m_rttEstimator.getMaxRtt() == time::nanoseconds::min()) {
@@ -441,21 +793,42 @@ PipelineInterestsAdaptive::printSummary() const
   }
 }
 
-std::ostream&
-operator<<(std::ostream& os, SegmentState state)
+void
+PipelineInterestsAdaptive::writeReport(JsonWriter& json) const
 {
-  switch (state) {
-  case SegmentState::FirstTimeSent:
-    os << "FirstTimeSent";
-    break;
-  case SegmentState::InRetxQueue:
-    os << "InRetxQueue";
-    break;
-  case SegmentState::Retransmitted:
-    os << "Retransmitted";
-    break;
+  PipelineInterests::writeReport(json);
+
+  json.member("interestsSent", m_nSent)
+      .member("retransmissions", m_nRetransmitted)
+      .member("skippedRetransmissions", m_nSkippedRetx)
+      .member("fastRetransmissions", m_nFastRetx)
+      .member("racingRetransmissions", m_nRacingRetx)
+      .member("timeouts", m_nTimeouts)
+      .member("congestionMarks", m_nCongMarks);
+  json.beginObject("windowDecreases")
+      .member("loss", m_nLossDecr)
+      .member("congestionMark", m_nMarkDecr)
+      .endObject();
+  // the slow start threshold is infinite until the first window decrease, written as null
+  auto window = getWindowState();
+  bool hasSsthresh = window.ssthresh < std::numeric_limits<double>::max();
+  json.member("cwnd", window.cwnd)
+      .member("ssthresh", hasSsthresh ? window.ssthresh : std::numeric_limits<double>::infinity());
+
+  if (m_rttHistogram.getNSamples() == 0) {
+    json.member("rttMs", nullptr);
+    return;
   }
-  return os;
+  auto toMs = [] (time::nanoseconds rtt) { return rtt.count() / 1e6; };
+  json.beginObject("rttMs")
+      .member("samples", m_rttHistogram.getNSamples())
+      .member("min", toMs(m_rttEstimator.getMinRtt()))
+      .member("avg", toMs(m_rttEstimator.getAvgRtt()))
+      .member("max", toMs(m_rttEstimator.getMaxRtt()))
+      .member("p50", toMs(m_rttHistogram.getPercentile(0.5)))
+      .member("p90", toMs(m_rttHistogram.getPercentile(0.9)))
+      .member("p99", toMs(m_rttHistogram.getPercentile(0.99)))
+      .endObject();
 }
 
 } // namespace ndn::get
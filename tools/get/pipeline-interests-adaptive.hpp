@@ -30,41 +30,22 @@
 #define NDN_TOOLS_GET_PIPELINE_INTERESTS_ADAPTIVE_HPP
 
 #include "pipeline-interests.hpp"
+#include "rtt-histogram.hpp"
+#include "segment-queue.hpp"
+#include "segment-table.hpp"
 
 #include <ndn-cxx/util/rtt-estimator.hpp>
 #include <ndn-cxx/util/scheduler.hpp>
 #include <ndn-cxx/util/signal.hpp>
 
+#include <functional>
 #include <queue>
-#include <unordered_map>
+#include <vector>
 
 namespace ndn::get {
 
 using util::RttEstimatorWithStats;
 
-/**
- * @brief indicates the state of the segment
- */
-enum class SegmentState {
-  FirstTimeSent, ///< segment has been sent for the first time
-  InRetxQueue,   ///< segment is in retransmission queue
-  Retransmitted, ///< segment has been retransmitted
-};
-
-std::ostream&
-operator<<(std::ostream& os, SegmentState state);
-
-/**
- * @brief Wraps up information that's necessary for segment transmission
- */
-struct SegmentInfo
-{
-  ScopedPendingInterestHandle interestHdl;
-  time::steady_clock::time_point timeSent;
-  time::nanoseconds rto;
-  SegmentState state;
-};
-
 /**
  * @brief Service for retrieving Data via an Interest pipeline
  *
@@ -111,12 +92,180 @@ public:
    */
   signal::Signal<PipelineInterestsAdaptive, RttSample> afterRttMeasurement;
 
+  /**
+   * @brief Signals when the pipeline stops, because the transfer is complete or has failed,
+   *        or because it has been cancelled.
+   *
+   * Not emitted when the pipeline is destroyed without having been stopped.
+   */
+  signal::Signal<PipelineInterestsAdaptive> afterCancel;
+
+  /**
+   * @brief Return the maximum rate at which Interests are sent, in Interests per second.
+   *
+   * The default implementation spreads the congestion window over the smoothed RTT if pacing
+   * is enabled (Options::enablePacing) and at least one RTT sample has been taken.
+   * @return the pacing rate, or 0 if Interests are not paced
+   */
+  virtual double
+  getPacingRate() const;
+
+  /**
+   * @brief Return the InterestLifetime of an Interest sent with a retransmission timeout of @p rto.
+   *
+   * This is the RTO plus Options::lifetimeMargin, between Options::minLifetime and
+   * Options::interestLifetime, if Options::enableAdaptiveLifetime is set, and
+   * Options::interestLifetime otherwise.
+   */
+  time::milliseconds
+  getInterestLifetime(time::nanoseconds rto) const;
+
+  /**
+   * @brief Return the estimated fraction of Data packets carrying a congestion mark.
+   *
+   * This is the moving average maintained when Options::enableDctcp is set, and 0 otherwise.
+   */
+  double
+  getMarkingFraction() const
+  {
+    return m_options.enableDctcp ? m_markingFraction : 0.0;
+  }
+
+  struct WindowState
+  {
+    double cwnd;     ///< congestion window size (in segments)
+    double ssthresh; ///< slow start threshold
+  };
+
+  /**
+   * @brief Return the current congestion window and slow start threshold.
+   *
+   * If the window is shared, see shareWindowOf(), this is the state of the shared window.
+   */
+  WindowState
+  getWindowState() const
+  {
+    return {m_windowOwner->m_cwnd, m_windowOwner->m_ssthresh};
+  }
+
+  struct Counters
+  {
+    size_t nReceivedBytes;  ///< total size of the segments received
+    int64_t nSent;          ///< # of Interests sent, including retransmissions
+    int64_t nRetransmitted; ///< # of retransmitted segments
+    int64_t nCongMarks;     ///< # of Data packets carrying a congestion mark
+    int64_t nInFlight;      ///< # of Interests currently in flight
+  };
+
+  /**
+   * @brief Return the counters of the transfer so far.
+   */
+  Counters
+  getCounters() const
+  {
+    return {m_receivedSize, m_nSent, m_nRetransmitted, m_nCongMarks, m_nInFlight};
+  }
+
+  /**
+   * @brief Start from the window reached by a previous transfer over the same path,
+   *        instead of Options::initCwnd and Options::initSsthresh.
+   *
+   * Must be called before run().
+   */
+  void
+  setWindowState(const WindowState& state);
+
+  /**
+   * @brief Learn the last segment number of the content from another pipeline fetching
+   *        a different stripe of the same content.
+   *
+   * Stops requesting segments beyond @p lastSegmentNo. Does nothing if the last segment
+   * number is already known.
+   */
+  void
+  setLastSegmentNo(uint64_t lastSegmentNo);
+
+  /**
+   * @brief Share the segments of the content with the pipelines of other paths through @p queue.
+   *
+   * New segments are taken from @p queue instead of being numbered by this pipeline, and lost
+   * segments are put back into it instead of being retransmitted on this path.
+   * Must be called before run().
+   */
+  void
+  setSegmentQueue(SegmentQueue& queue, size_t pathId)
+  {
+    m_segmentQueue = &queue;
+    m_pathId = pathId;
+  }
+
+  /**
+   * @brief Return whether the window of this pipeline can be shared with other transfers,
+   *        see shareWindowOf().
+   */
+  virtual bool
+  canShareWindow() const
+  {
+    return true;
+  }
+
+  /**
+   * @brief Use the congestion window of @p owner instead of a window of its own.
+   *
+   * All the pipelines sharing the window of @p owner form a group, whose Interests in flight
+   * are bounded by that window, and each of which may use an equal share of it. Every Data
+   * packet, loss, and congestion mark of a member adjusts the shared window, and every RTT
+   * sample is also given to @p owner, e.g., for delay-based window adjustments. @p owner must
+   * be a pipeline of the same type that is not run, must use the same RTT estimator, and must
+   * outlive this pipeline. The conservative window adaptation still applies per transfer.
+   * Must be called before run().
+   */
+  void
+  shareWindowOf(PipelineInterestsAdaptive& owner);
+
+  /**
+   * @brief Send Interests if the window allows, e.g., after the pipeline of another path
+   *        has queued lost segments.
+   */
+  void
+  sendPendingInterests();
+
+  void
+  writeReport(JsonWriter& json) const override;
+
 protected:
   DECLARE_SIGNAL_EMIT(afterCwndChange)
 
   void
   printOptions() const;
 
+  /**
+   * @brief Return the number of Interests currently in flight.
+   */
+  int64_t
+  getNInFlight() const
+  {
+    return m_nInFlight;
+  }
+
+  /**
+   * @brief Return the highest segment number requested so far.
+   */
+  uint64_t
+  getHighInterest() const
+  {
+    return m_highInterest;
+  }
+
+  /**
+   * @brief Return whether the window is shared with other transfers, see shareWindowOf().
+   */
+  bool
+  isWindowShared() const
+  {
+    return m_windowOwner != this || !m_windowSharers.empty();
+  }
+
 private:
   /**
    * @brief Increase congestion window.
@@ -130,6 +279,28 @@ private:
   virtual void
   decreaseWindow() = 0;
 
+  /**
+   * @brief Decrease congestion window in proportion to the extent of congestion.
+   *
+   * Used instead of decreaseWindow() in reaction to congestion marks when Options::enableDctcp
+   * is set. The default implementation multiplies the window by `1 - markingFraction / 2`.
+   *
+   * @param markingFraction estimated fraction of marked Data packets, between 0 and 1
+   */
+  virtual void
+  decreaseWindowProportionally(double markingFraction);
+
+  /**
+   * @brief Called for every Data packet that answers a pending segment, before the window is
+   *        adjusted, whether or not it carries a congestion mark.
+   *
+   * The default implementation does nothing.
+   */
+  virtual void
+  handleAckedData()
+  {
+  }
+
 private:
   /**
    * @brief Fetch all the segments between 0 and lastSegment of the specified prefix.
@@ -148,11 +319,29 @@ private:
   doCancel() final;
 
   /**
-   * @brief Check RTO for all sent-but-not-acked segments.
+   * @brief Cancel the timers and the pending Interests, without emitting afterCancel.
+   */
+  void
+  stopFetching();
+
+  void
+  doResume() final;
+
+  /**
+   * @brief Handle the expiration of the earliest retransmission timer.
+   *
+   * Enqueues for retransmission every segment whose retransmission timer has expired,
+   * then re-arms the timer event for the next pending deadline.
    */
   void
   checkRto();
 
+  /**
+   * @brief Make sure the timer event fires at the earliest pending deadline.
+   */
+  void
+  armRtoTimer();
+
   /**
    * @param segNo the segment # of the to-be-sent Interest
    * @param isRetransmission true if this is a retransmission
@@ -163,6 +352,32 @@ private:
   void
   schedulePackets();
 
+  /**
+   * @brief Return the number of Interests that can be sent now according to the window.
+   */
+  int64_t
+  getAvailableWindowSize() const;
+
+  /**
+   * @brief Return the part of the window that this pipeline may use.
+   */
+  double
+  getWindowShare() const;
+
+  /**
+   * @brief Let the pipelines sharing the window of this one send Interests if it allows,
+   *        once the current event has been processed.
+   */
+  void
+  wakeWindowSharers();
+
+  /**
+   * @brief Retransmit the oldest segment of the shared queue that was lost on another path
+   * @return false if there is no such segment
+   */
+  bool
+  retransmitLostSegment();
+
   void
   handleData(const Interest& interest, const Data& data);
 
@@ -175,12 +390,40 @@ private:
   void
   recordTimeout(uint64_t segNo);
 
+  /**
+   * @brief Decrease the window in reaction to the loss of segment @p segNo
+   * @return true if the window was decreased, false if this loss belongs to the same
+   *         congestion event as a previous one (conservative window adaptation)
+   */
+  bool
+  recordLoss(uint64_t segNo);
+
+  /**
+   * @brief Enqueue for early retransmission the segments considered lost because at least
+   *        FAST_RETX_THRESHOLD higher-numbered segments of the stripe have been received
+   */
+  void
+  detectLosses();
+
   void
   enqueueForRetransmission(uint64_t segNo);
 
+  /**
+   * @brief Update the marking fraction estimate and react to the marks at the end of each window.
+   */
+  void
+  updateMarkingFraction(uint64_t segNo, bool isMarked);
+
   void
   handleFail(uint64_t segNo, const std::string& reason);
 
+  /**
+   * @brief Record the last segment number of the content and stop fetching the segments after it
+   * @return false if a segment that previously failed turns out to be part of the content
+   */
+  bool
+  handleFinalBlockId(uint64_t lastSegmentNo);
+
   void
   cancelInFlightSegmentsGreaterThan(uint64_t segNo);
 
@@ -190,6 +433,7 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
 PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   static constexpr double MIN_SSTHRESH = 2.0;
+  static constexpr uint64_t FAST_RETX_THRESHOLD = 3; ///< reordering tolerated before fast retransmit
 
   double m_cwnd; ///< current congestion window size (in segments)
   double m_ssthresh; ///< current slow start threshold
@@ -198,6 +442,27 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED:
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Scheduler m_scheduler;
   scheduler::ScopedEventId m_checkRtoEvent;
+  time::steady_clock::time_point m_checkRtoDeadline = time::steady_clock::time_point::max();
+                                                     ///< when m_checkRtoEvent is due, max() if not armed
+
+  struct RtoTimer
+  {
+    time::steady_clock::time_point deadline; ///< timeSent + rto of the transmission
+    uint64_t segNo;
+
+    friend bool
+    operator>(const RtoTimer& lhs, const RtoTimer& rhs)
+    {
+      return lhs.deadline > rhs.deadline;
+    }
+  };
+  /// Retransmission timers ordered by deadline. Entries are not removed when a segment is received
+  /// or retransmitted; stale entries are recognized and discarded when they reach the top.
+  std::priority_queue<RtoTimer, std::vector<RtoTimer>, std::greater<>> m_rtoTimers;
+
+  scheduler::ScopedEventId m_pacingEvent;
+  time::steady_clock::time_point m_nextSendTime; ///< earliest time the next Interest can be sent
+                                                 ///< when pacing is enabled
 
   uint64_t m_highData = 0; ///< the highest segment number of the Data packet the consumer has received so far
   uint64_t m_highInterest = 0; ///< the highest segment number of the Interests the consumer has sent so far
@@ -211,15 +476,32 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   int64_t m_nSkippedRetx = 0; ///< # of segments queued for retransmission but received before the
                               ///< retransmission occurred
   int64_t m_nRetransmitted = 0; ///< # of retransmitted segments
+  int64_t m_nFastRetx = 0; ///< # of segments retransmitted before their RTO expired
+  int64_t m_nRacingRetx = 0; ///< # of retransmissions sent before the lifetime of the previous
+                             ///< Interest for the same segment expired
+  uint64_t m_lossScanSegNo = 0; ///< segments below this number have been checked by detectLosses()
   int64_t m_nCongMarks = 0; ///< # of data packets with congestion mark
   int64_t m_nSent = 0; ///< # of interest packets sent out (including retransmissions)
-
-  std::unordered_map<uint64_t, SegmentInfo> m_segmentInfo; ///< keeps all the internal information
-                                                           ///< on sent but not acked segments
-  std::unordered_map<uint64_t, int> m_retxCount; ///< maps segment number to its retransmission count;
-                                                 ///< if the count reaches to the maximum number of
-                                                 ///< timeout/nack retries, the pipeline will be aborted
+  RttHistogram m_rttHistogram; ///< distribution of the RTT samples given to m_rttEstimator
+
+  double m_markingFraction = 1.0; ///< moving average of the fraction of marked Data packets per window
+  uint64_t m_markWindowEnd = 0; ///< the current observation window ends when this segment or a later
+                                ///< one is received, set when the pipeline starts
+  int64_t m_nAckedInWindow = 0; ///< # of Data packets received in the current observation window
+  int64_t m_nMarkedInWindow = 0; ///< # of those Data packets that carried a congestion mark
+
+  SegmentTable m_segmentTable; ///< keeps all the internal information on sent but not acked
+                               ///< segments, including their retransmission count; if the count
+                               ///< reaches the maximum number of timeout/nack retries,
+                               ///< the pipeline will be aborted
   std::queue<uint64_t> m_retxQueue;
+  SegmentQueue* m_segmentQueue = nullptr; ///< shared with the pipelines of other paths, may be null
+  size_t m_pathId = 0;
+
+  PipelineInterestsAdaptive* m_windowOwner = this; ///< pipeline whose window is used, this if not shared
+  std::vector<PipelineInterestsAdaptive*> m_windowSharers; ///< running pipelines using the window
+                                                           ///< of this one
+  bool m_isWakeUpPending = false;
 
   bool m_hasFailure = false;
   uint64_t m_failedSegNo = 0;
@@ -0,0 +1,268 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "pipeline-interests-bbr.hpp"
+
+#include <ndn-cxx/util/random.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+namespace ndn::get {
+
+constexpr double STARTUP_GAIN = 2.885; // 2/ln(2)
+constexpr double PROBE_BW_CWND_GAIN = 2.0;
+constexpr std::array<double, 8> PROBE_BW_PACING_GAINS{1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+constexpr double FULL_BW_THRESHOLD = 1.25;
+constexpr int FULL_BW_ROUNDS = 3;
+constexpr time::nanoseconds MIN_RTT_WINDOW = 10_s;
+constexpr time::nanoseconds PROBE_RTT_DURATION = 200_ms;
+
+static double
+toSeconds(time::nanoseconds d)
+{
+  return d.count() / 1e9;
+}
+
+PipelineInterestsBbr::PipelineInterestsBbr(Face& face, RttEstimatorWithStats& rttEstimator,
+                                           const Options& opts)
+  : PipelineInterestsAdaptive(face, rttEstimator, opts)
+  , m_pacingGain(STARTUP_GAIN)
+  , m_cwndGain(STARTUP_GAIN)
+{
+  afterRttMeasurement.connect([this] (const RttSample& sample) { handleRttSample(sample.rtt); });
+
+  if (m_options.isVerbose) {
+    printOptions();
+  }
+}
+
+void
+PipelineInterestsBbr::increaseWindow()
+{
+}
+
+void
+PipelineInterestsBbr::handleAckedData()
+{
+  // count the segment being handled before taking a sample, m_nReceived is only updated later
+  m_nDelivered++;
+
+  auto now = time::steady_clock::now();
+  updateBandwidth(now);
+  updateMode(now);
+  updateControls();
+
+  emitSignal(afterCwndChange, now - getStartTime(), m_cwnd);
+}
+
+void
+PipelineInterestsBbr::decreaseWindow()
+{
+}
+
+void
+PipelineInterestsBbr::handleRttSample(time::nanoseconds rtt)
+{
+  auto now = time::steady_clock::now();
+  if (m_minRtt == time::nanoseconds::max()) {
+    // first sample, start counting rounds
+    m_roundStart = now;
+    m_roundStartDelivered = m_nDelivered;
+  }
+  else {
+    m_isMinRttExpired = now - m_minRttStamp > MIN_RTT_WINDOW;
+  }
+
+  if (rtt <= m_minRtt || m_isMinRttExpired) {
+    m_minRtt = rtt;
+    m_minRttStamp = now;
+  }
+}
+
+void
+PipelineInterestsBbr::updateBandwidth(time::steady_clock::time_point now)
+{
+  m_isRoundStart = false;
+  if (m_minRtt == time::nanoseconds::max() || now - m_roundStart < m_minRtt) {
+    return;
+  }
+
+  double deliveryRate = (m_nDelivered - m_roundStartDelivered) / toSeconds(now - m_roundStart);
+  m_bwSamples[m_nRounds % BW_FILTER_LENGTH] = deliveryRate;
+  m_btlBw = *std::max_element(m_bwSamples.begin(), m_bwSamples.end());
+
+  m_nRounds++;
+  m_isRoundStart = true;
+  m_roundStart = now;
+  m_roundStartDelivered = m_nDelivered;
+}
+
+void
+PipelineInterestsBbr::updateMode(time::steady_clock::time_point now)
+{
+  if (m_isRoundStart && !m_isFullPipe) {
+    if (m_btlBw >= m_fullBw * FULL_BW_THRESHOLD) {
+      m_fullBw = m_btlBw;
+      m_nFullBwRounds = 0;
+    }
+    else if (++m_nFullBwRounds >= FULL_BW_ROUNDS) {
+      m_isFullPipe = true;
+    }
+  }
+
+  switch (m_mode) {
+    case Mode::Startup:
+      if (m_isFullPipe) {
+        enterMode(Mode::Drain, now);
+      }
+      break;
+    case Mode::Drain:
+      if (getNInFlight() <= getBdp()) {
+        enterMode(Mode::ProbeBw, now);
+      }
+      break;
+    case Mode::ProbeBw: {
+      // each phase lasts one min RTT, the drain phase ends as soon as the queue is empty
+      bool isPhaseOver = now - m_cycleStart > m_minRtt ||
+                         (m_pacingGain < 1.0 && getNInFlight() <= getBdp());
+      if (isPhaseOver) {
+        m_cycleIndex = (m_cycleIndex + 1) % PROBE_BW_PACING_GAINS.size();
+        m_cycleStart = now;
+        m_pacingGain = PROBE_BW_PACING_GAINS[m_cycleIndex];
+      }
+      break;
+    }
+    case Mode::ProbeRtt:
+      if (m_probeRttDone == time::steady_clock::time_point{} && getNInFlight() <= MIN_CWND) {
+        m_probeRttDone = now + std::max(PROBE_RTT_DURATION, m_minRtt);
+      }
+      else if (m_probeRttDone != time::steady_clock::time_point{} && now >= m_probeRttDone) {
+        m_minRttStamp = now;
+        m_cwnd = std::max(m_cwnd, m_priorCwnd);
+        enterMode(m_isFullPipe ? Mode::ProbeBw : Mode::Startup, now);
+      }
+      break;
+  }
+
+  if (m_isMinRttExpired && m_mode != Mode::ProbeRtt) {
+    enterMode(Mode::ProbeRtt, now);
+  }
+  m_isMinRttExpired = false;
+}
+
+void
+PipelineInterestsBbr::updateControls()
+{
+  if (m_btlBw == 0.0) {
+    // no bandwidth estimate yet, grow the window as in slow start
+    m_cwnd += 1.0;
+    if (m_minRtt != time::nanoseconds::max()) {
+      m_pacingRate = m_pacingGain * m_cwnd / toSeconds(m_minRtt);
+    }
+    return;
+  }
+
+  m_pacingRate = m_pacingGain * m_btlBw;
+
+  if (m_mode == Mode::ProbeRtt) {
+    m_cwnd = MIN_CWND;
+    return;
+  }
+
+  double target = std::max(m_cwndGain * getBdp(), MIN_CWND);
+  if (m_isFullPipe) {
+    m_cwnd = std::min(m_cwnd + 1.0, target);
+  }
+  else if (m_cwnd < target) {
+    m_cwnd += 1.0;
+  }
+  m_cwnd = std::max(m_cwnd, MIN_CWND);
+}
+
+void
+PipelineInterestsBbr::enterMode(Mode mode, time::steady_clock::time_point now)
+{
+  m_mode = mode;
+  switch (mode) {
+    case Mode::Startup:
+      m_pacingGain = STARTUP_GAIN;
+      m_cwndGain = STARTUP_GAIN;
+      break;
+    case Mode::Drain:
+      m_pacingGain = 1.0 / STARTUP_GAIN;
+      m_cwndGain = STARTUP_GAIN;
+      break;
+    case Mode::ProbeBw:
+      // start at a random phase other than the drain phase, to avoid synchronizing with other flows
+      m_cycleIndex = (random::generateWord32() % (PROBE_BW_PACING_GAINS.size() - 1) + 2) %
+                     PROBE_BW_PACING_GAINS.size();
+      m_cycleStart = now;
+      m_pacingGain = PROBE_BW_PACING_GAINS[m_cycleIndex];
+      m_cwndGain = PROBE_BW_CWND_GAIN;
+      break;
+    case Mode::ProbeRtt:
+      m_priorCwnd = m_cwnd;
+      m_probeRttDone = {};
+      m_pacingGain = 1.0;
+      m_cwndGain = 1.0;
+      break;
+  }
+
+  if (m_options.isVerbose) {
+    std::cerr << "BBR mode = " << mode
+              << ", bottleneck bandwidth = " << m_btlBw << " segments/s"
+              << ", min RTT = " << m_minRtt.count() / 1e6 << "ms\n";
+  }
+}
+
+double
+PipelineInterestsBbr::getBdp() const
+{
+  if (m_minRtt == time::nanoseconds::max()) {
+    return m_options.initCwnd;
+  }
+  return m_btlBw * toSeconds(m_minRtt);
+}
+
+std::ostream&
+operator<<(std::ostream& os, PipelineInterestsBbr::Mode mode)
+{
+  switch (mode) {
+  case PipelineInterestsBbr::Mode::Startup:
+    os << "Startup";
+    break;
+  case PipelineInterestsBbr::Mode::Drain:
+    os << "Drain";
+    break;
+  case PipelineInterestsBbr::Mode::ProbeBw:
+    os << "ProbeBw";
+    break;
+  case PipelineInterestsBbr::Mode::ProbeRtt:
+    os << "ProbeRtt";
+    break;
+  }
+  return os;
+}
+
+} // namespace ndn::get
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_PIPELINE_INTERESTS_BBR_HPP
+#define NDN_TOOLS_GET_PIPELINE_INTERESTS_BBR_HPP
+
+#include "pipeline-interests-adaptive.hpp"
+
+#include <array>
+
+namespace ndn::get {
+
+/**
+ * @brief Implements a rate-based pipeline modeled after TCP BBR.
+ *
+ * Instead of reacting to losses and congestion marks, the pipeline keeps a model of the path made
+ * of the bottleneck bandwidth (the maximum delivery rate over the last rounds) and of the minimum
+ * RTT (over the last 10 seconds). Interests are paced at a multiple of the bottleneck bandwidth
+ * and the window is capped at a multiple of the bandwidth-delay product, with gains that depend
+ * on the current mode: Startup, Drain, ProbeBw, or ProbeRtt.
+ *
+ * This follows the BBR (version 1) description in https://datatracker.ietf.org/doc/draft-cardwell-iccrg-bbr-congestion-control/
+ * except that the delivery rate is sampled once per round instead of once per Data packet.
+ * The model is updated for every Data packet, including those carrying a congestion mark.
+ */
+class PipelineInterestsBbr final : public PipelineInterestsAdaptive
+{
+public:
+  PipelineInterestsBbr(Face& face, RttEstimatorWithStats& rttEstimator, const Options& opts);
+
+  /**
+   * @brief Return the pacing rate derived from the bottleneck bandwidth estimate.
+   *
+   * Interests are always paced, regardless of Options::enablePacing.
+   */
+  double
+  getPacingRate() const final
+  {
+    return m_pacingRate;
+  }
+
+  /**
+   * @brief The model describes the path as seen by a single transfer, so the window is never shared.
+   */
+  bool
+  canShareWindow() const final
+  {
+    return false;
+  }
+
+  enum class Mode {
+    Startup,  ///< exponential growth until the bottleneck bandwidth stops increasing
+    Drain,    ///< drain the queue created during Startup
+    ProbeBw,  ///< cruise at the bottleneck bandwidth, periodically probing for more
+    ProbeRtt, ///< shrink the window to measure the minimum RTT without queueing
+  };
+
+private:
+  /**
+   * @brief The window follows the model, see handleAckedData(), this does nothing.
+   */
+  void
+  increaseWindow() final;
+
+  /**
+   * @brief Loss and congestion marks are not used as congestion signals, this does nothing.
+   */
+  void
+  decreaseWindow() final;
+
+  void
+  decreaseWindowProportionally(double) final
+  {
+  }
+
+  /**
+   * @brief Update the model of the path and the controls derived from it.
+   */
+  void
+  handleAckedData() final;
+
+  void
+  handleRttSample(time::nanoseconds rtt);
+
+  /**
+   * @brief Take a delivery rate sample at the end of each round and update the bandwidth filter.
+   */
+  void
+  updateBandwidth(time::steady_clock::time_point now);
+
+  void
+  updateMode(time::steady_clock::time_point now);
+
+  /**
+   * @brief Set the window and the pacing rate according to the model and the current mode.
+   */
+  void
+  updateControls();
+
+  void
+  enterMode(Mode mode, time::steady_clock::time_point now);
+
+  /**
+   * @brief Return the estimated bandwidth-delay product, in segments.
+   */
+  double
+  getBdp() const;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static constexpr size_t BW_FILTER_LENGTH = 10; ///< in rounds
+  static constexpr double MIN_CWND = 4.0;
+
+  Mode m_mode = Mode::Startup;
+  double m_pacingRate = 0.0; ///< in Interests per second, 0 until the min RTT is known
+  double m_pacingGain;
+  double m_cwndGain;
+
+  double m_btlBw = 0.0; ///< estimated bottleneck bandwidth (in segments per second)
+  std::array<double, BW_FILTER_LENGTH> m_bwSamples{}; ///< delivery rate of the last rounds
+  time::nanoseconds m_minRtt = time::nanoseconds::max();
+  time::steady_clock::time_point m_minRttStamp; ///< when m_minRtt was last updated
+  bool m_isMinRttExpired = false;
+
+  uint64_t m_nRounds = 0;
+  bool m_isRoundStart = false; ///< true if the current Data packet started a new round
+  time::steady_clock::time_point m_roundStart;
+  int64_t m_nDelivered = 0; ///< # of segments received, including the one being handled
+  int64_t m_roundStartDelivered = 0; ///< # of segments received when the current round started
+
+  bool m_isFullPipe = false; ///< true if the bottleneck bandwidth has been reached in Startup
+  double m_fullBw = 0.0;
+  int m_nFullBwRounds = 0; ///< # of rounds without significant bandwidth growth
+
+  size_t m_cycleIndex = 0; ///< current phase of the ProbeBw gain cycle
+  time::steady_clock::time_point m_cycleStart;
+
+  time::steady_clock::time_point m_probeRttDone; ///< end of ProbeRtt, unset until the window
+                                                 ///< has been drained to MIN_CWND
+  double m_priorCwnd = 0.0; ///< window before entering ProbeRtt
+};
+
+std::ostream&
+operator<<(std::ostream& os, PipelineInterestsBbr::Mode mode);
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_PIPELINE_INTERESTS_BBR_HPP
@@ -25,6 +25,7 @@
 
 #include "pipeline-interests-cubic.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -32,15 +33,27 @@ namespace ndn::get {
 
 constexpr double CUBIC_C = 0.4;
 
+// HyStart parameters, same as the Linux kernel
+constexpr double HYSTART_LOW_WINDOW = 16.0;
+constexpr time::nanoseconds HYSTART_ACK_DELTA = 2_ms;
+constexpr int HYSTART_MIN_SAMPLES = 8;
+constexpr time::nanoseconds HYSTART_DELAY_MIN = 4_ms;
+constexpr time::nanoseconds HYSTART_DELAY_MAX = 16_ms;
+
 PipelineInterestsCubic::PipelineInterestsCubic(Face& face, RttEstimatorWithStats& rttEstimator,
                                                const Options& opts)
   : PipelineInterestsAdaptive(face, rttEstimator, opts)
   , m_lastDecrease(time::steady_clock::now())
 {
+  if (!m_options.disableHystart) {
+    afterRttMeasurement.connect([this] (const RttSample& sample) { handleRttSample(sample); });
+  }
+
   if (m_options.isVerbose) {
     printOptions();
     std::cerr << "\tCubic beta = " << m_options.cubicBeta << "\n"
-              << "\tFast convergence = " << (m_options.enableFastConv ? "yes" : "no") << "\n";
+              << "\tFast convergence = " << (m_options.enableFastConv ? "yes" : "no") << "\n"
+              << "\tHyStart = " << (m_options.disableHystart ? "no" : "yes") << "\n";
   }
 }
 
@@ -57,20 +70,16 @@ PipelineInterestsCubic::increaseWindow()
     // if m_ssthresh is large enough.
     if (m_wmax < m_options.initCwnd) {
       m_wmax = m_cwnd;
+      m_k = std::cbrt(m_wmax * (1 - m_options.cubicBeta) / CUBIC_C);
     }
 
     // 1. Time since last congestion event in seconds
     const double t = (time::steady_clock::now() - m_lastDecrease).count() / 1e9;
 
-    // 2. Time it takes to increase the window to m_wmax = the cwnd right before the last
-    // window decrease.
-    // K = cubic_root(wmax*(1-beta_cubic)/C) (Eq. 2)
-    const double k = std::cbrt(m_wmax * (1 - m_options.cubicBeta) / CUBIC_C);
+    // 2. Target: W_cubic(t) = C*(t-K)^3 + wmax (Eq. 1), K is computed when the epoch starts
+    const double wCubic = CUBIC_C * std::pow(t - m_k, 3) + m_wmax;
 
-    // 3. Target: W_cubic(t) = C*(t-K)^3 + wmax (Eq. 1)
-    const double wCubic = CUBIC_C * std::pow(t - k, 3) + m_wmax;
-
-    // 4. Estimate of Reno Increase (Eq. 4)
+    // 3. Estimate of Reno Increase (Eq. 4)
     const double rtt = m_rttEstimator.getSmoothedRtt().count() / 1e9;
     const double wEst = m_wmax * m_options.cubicBeta +
                         (3 * (1 - m_options.cubicBeta) / (1 + m_options.cubicBeta)) * (t / rtt);
@@ -104,6 +113,11 @@ PipelineInterestsCubic::decreaseWindow()
     m_wmax = m_cwnd;
   }
 
+  // Time it takes to increase the window to m_wmax = the cwnd right before the last
+  // window decrease.
+  // K = cubic_root(wmax*(1-beta_cubic)/C) (Eq. 2)
+  m_k = std::cbrt(m_wmax * (1 - m_options.cubicBeta) / CUBIC_C);
+
   m_ssthresh = std::max(m_options.initCwnd, m_cwnd * m_options.cubicBeta);
   m_cwnd = m_ssthresh;
   m_lastDecrease = time::steady_clock::now();
@@ -111,4 +125,103 @@ PipelineInterestsCubic::decreaseWindow()
   emitSignal(afterCwndChange, time::steady_clock::now() - getStartTime(), m_cwnd);
 }
 
+void
+PipelineInterestsCubic::decreaseWindowProportionally(double markingFraction)
+{
+  // restart the cubic function from the window before the decrease
+  m_lastWmax = m_cwnd;
+  m_wmax = m_cwnd;
+  m_k = std::cbrt(m_wmax * (1 - m_options.cubicBeta) / CUBIC_C);
+
+  m_ssthresh = std::max(m_options.initCwnd, m_cwnd * (1.0 - markingFraction / 2.0));
+  m_cwnd = m_ssthresh;
+  m_lastDecrease = time::steady_clock::now();
+
+  emitSignal(afterCwndChange, time::steady_clock::now() - getStartTime(), m_cwnd);
+}
+
+void
+PipelineInterestsCubic::handleRttSample(const RttSample& sample)
+{
+  if (m_cwnd >= m_ssthresh) {
+    return; // not in slow start
+  }
+  if (isWindowShared()) {
+    return; // the rounds of the transfers sharing the window are not aligned
+  }
+
+  auto now = time::steady_clock::now();
+  if (m_roundStart == time::steady_clock::time_point{} || sample.segNum > m_roundEnd) {
+    // a segment requested after the beginning of the current round has been received
+    m_roundEnd = getHighInterest();
+    m_roundStart = now;
+    m_lastAckTime = now;
+    m_lastRoundMinRtt = m_curRoundMinRtt;
+    m_curRoundMinRtt = time::nanoseconds::max();
+    m_nRoundSamples = 0;
+  }
+
+  if (m_nRoundSamples < HYSTART_MIN_SAMPLES) {
+    m_curRoundMinRtt = std::min(m_curRoundMinRtt, sample.rtt);
+    m_nRoundSamples++;
+  }
+
+  if (m_cwnd < HYSTART_LOW_WINDOW) {
+    return;
+  }
+
+  // ACK train: Data packets keep arriving closely spaced for at least half the min RTT,
+  // meaning that the window is at least as large as the bandwidth-delay product
+  if (now - m_lastAckTime <= HYSTART_ACK_DELTA) {
+    m_lastAckTime = now;
+    if (now - m_roundStart > m_rttEstimator.getMinRtt() / 2) {
+      return exitSlowStart(HystartExit::ACK_TRAIN);
+    }
+  }
+
+  // delay increase: the RTT has grown compared to the previous round, a queue is building up
+  if (m_nRoundSamples >= HYSTART_MIN_SAMPLES && m_lastRoundMinRtt != time::nanoseconds::max()) {
+    auto threshold = std::clamp(m_lastRoundMinRtt / 8, HYSTART_DELAY_MIN, HYSTART_DELAY_MAX);
+    if (m_curRoundMinRtt >= m_lastRoundMinRtt + threshold) {
+      return exitSlowStart(HystartExit::DELAY_INCREASE);
+    }
+  }
+}
+
+void
+PipelineInterestsCubic::exitSlowStart(HystartExit reason)
+{
+  m_ssthresh = m_cwnd;
+  m_hystartExit = reason;
+
+  // start a new epoch at the current window (K = 0), like the epoch_start reset in Linux,
+  // so that the window does not follow a curve left over from before slow start
+  m_wmax = m_cwnd;
+  m_k = 0.0;
+  m_lastDecrease = time::steady_clock::now();
+
+  if (m_options.isVerbose) {
+    std::cerr << "HyStart: leaving slow start at cwnd = " << m_cwnd << " because of " << reason
+              << " (current round min RTT = " << m_curRoundMinRtt.count() / 1e6 << "ms"
+              << ", previous round min RTT = " << m_lastRoundMinRtt.count() / 1e6 << "ms)\n";
+  }
+}
+
+std::ostream&
+operator<<(std::ostream& os, PipelineInterestsCubic::HystartExit reason)
+{
+  switch (reason) {
+  case PipelineInterestsCubic::HystartExit::NONE:
+    os << "none";
+    break;
+  case PipelineInterestsCubic::HystartExit::ACK_TRAIN:
+    os << "ACK train";
+    break;
+  case PipelineInterestsCubic::HystartExit::DELAY_INCREASE:
+    os << "delay increase";
+    break;
+  }
+  return os;
+}
+
 } // namespace ndn::get
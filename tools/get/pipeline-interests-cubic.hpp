@@ -41,6 +41,12 @@ class PipelineInterestsCubic final : public PipelineInterestsAdaptive
 public:
   PipelineInterestsCubic(Face& face, RttEstimatorWithStats& rttEstimator, const Options& opts);
 
+  enum class HystartExit {
+    NONE,           ///< slow start has not been ended by HyStart
+    ACK_TRAIN,      ///< a train of closely spaced Data packets lasted at least half the min RTT
+    DELAY_INCREASE, ///< the RTT increased significantly compared to the previous round
+  };
+
 private:
   void
   increaseWindow() final;
@@ -48,12 +54,39 @@ private:
   void
   decreaseWindow() final;
 
-private:
+  void
+  decreaseWindowProportionally(double markingFraction) final;
+
+  /**
+   * @brief Look for signs that the path is full while in slow start (HyStart)
+   *
+   * Not done if the window is shared with other transfers, see shareWindowOf().
+   */
+  void
+  handleRttSample(const RttSample& sample);
+
+  void
+  exitSlowStart(HystartExit reason);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   double m_wmax = 0.0; ///< window size before last window decrease
   double m_lastWmax = 0.0; ///< last wmax
-  time::steady_clock::time_point m_lastDecrease; ///< time of last window decrease
+  double m_k = 0.0; ///< time (in seconds) it takes to grow the window back to wmax in this epoch
+  time::steady_clock::time_point m_lastDecrease; ///< start of the current epoch
+
+  // HyStart state
+  HystartExit m_hystartExit = HystartExit::NONE;
+  uint64_t m_roundEnd = 0; ///< the current round ends when a segment above this one is received
+  time::steady_clock::time_point m_roundStart; ///< unset if no round has started yet
+  time::steady_clock::time_point m_lastAckTime; ///< arrival of the last Data packet in the ACK train
+  time::nanoseconds m_lastRoundMinRtt = time::nanoseconds::max();
+  time::nanoseconds m_curRoundMinRtt = time::nanoseconds::max();
+  int m_nRoundSamples = 0;
 };
 
+std::ostream&
+operator<<(std::ostream& os, PipelineInterestsCubic::HystartExit reason);
+
 } // namespace ndn::get
 
 #endif // NDN_TOOLS_GET_PIPELINE_INTERESTS_CUBIC_HPP
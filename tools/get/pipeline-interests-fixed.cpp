@@ -53,13 +53,28 @@ PipelineInterestsFixed::~PipelineInterestsFixed()
 void
 PipelineInterestsFixed::doRun()
 {
+  if (allSegmentsReceived()) {
+    // nothing left to fetch from a resumed transfer
+    if (!m_options.isQuiet) {
+      printSummary();
+    }
+    return;
+  }
+
   // if the FinalBlockId is unknown, this could potentially request non-existent segments
   for (size_t nRequestedSegments = 0;
        nRequestedSegments < m_options.maxPipelineSize;
        ++nRequestedSegments) {
-    if (!fetchNextSegment(nRequestedSegments))
-      // all segments have been requested
+    if (!fetchNextSegment(nRequestedSegments)) {
+      if (!m_stalledPipes.empty()) {
+        // requests are held back, the pipes that have not been started are resumed with it
+        for (size_t pipeNo = nRequestedSegments + 1; pipeNo < m_options.maxPipelineSize; ++pipeNo) {
+          m_stalledPipes.push_back(pipeNo);
+        }
+      }
+      // otherwise, all segments have been requested
       break;
+    }
   }
 }
 
@@ -74,6 +89,12 @@ PipelineInterestsFixed::fetchNextSegment(std::size_t pipeNo)
     return false;
   }
 
+  if (!canRequestNewSegment()) {
+    // backpressure or FinalBlockId probing, this pipe will be restarted by doResume()
+    m_stalledPipes.push_back(pipeNo);
+    return false;
+  }
+
   uint64_t nextSegmentNo = getNextSegmentNo();
   if (m_hasFinalBlockId && nextSegmentNo > m_lastSegmentNo)
     return false;
@@ -82,10 +103,7 @@ PipelineInterestsFixed::fetchNextSegment(std::size_t pipeNo)
   if (m_options.isVerbose)
     std::cerr << "Requesting segment #" << nextSegmentNo << "\n";
 
-  auto interest = Interest()
-                  .setName(Name(m_prefix).appendSegment(nextSegmentNo))
-                  .setMustBeFresh(m_options.mustBeFresh)
-                  .setInterestLifetime(m_options.interestLifetime);
+  auto interest = makeInterest(nextSegmentNo, m_options.interestLifetime);
 
   auto fetcher = DataFetcher::fetch(m_face, interest,
                                     m_options.maxRetriesOnTimeoutOrNack,
@@ -116,6 +134,17 @@ PipelineInterestsFixed::doCancel()
   }
 
   m_segmentFetchers.clear();
+  m_stalledPipes.clear();
+}
+
+void
+PipelineInterestsFixed::doResume()
+{
+  auto stalledPipes = std::move(m_stalledPipes);
+  m_stalledPipes.clear();
+  for (size_t pipeNo : stalledPipes) {
+    fetchNextSegment(pipeNo);
+  }
 }
 
 void
@@ -133,8 +162,7 @@ PipelineInterestsFixed::handleData(const Interest& interest, const Data& data, s
   onData(data);
 
   if (!m_hasFinalBlockId && data.getFinalBlock()) {
-    m_lastSegmentNo = data.getFinalBlock()->toSegment();
-    m_hasFinalBlockId = true;
+    recordFinalBlockId(data.getFinalBlock()->toSegment());
 
     for (auto& fetcher : m_segmentFetchers) {
       if (fetcher.first == nullptr)
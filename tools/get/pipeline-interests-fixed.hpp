@@ -55,6 +55,12 @@ public:
 
   ~PipelineInterestsFixed() final;
 
+  size_t
+  getMaxWindowSize() const final
+  {
+    return m_options.maxPipelineSize;
+  }
+
 private:
   /**
    * @brief fetch all the segments between 0 and m_lastSegmentNo
@@ -68,6 +74,9 @@ private:
   void
   doCancel() final;
 
+  void
+  doResume() final;
+
   /**
    * @brief fetch the next segment that has not been requested yet
    *
@@ -84,6 +93,7 @@ private:
 
 private:
   std::vector<std::pair<std::shared_ptr<DataFetcher>, uint64_t>> m_segmentFetchers;
+  std::vector<size_t> m_stalledPipes; ///< pipes left idle because new segments are held back
 
   /**
    * true if one or more segment fetchers encountered an error; if m_hasFinalBlockId
@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "pipeline-interests-ledbat.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace ndn::get {
+
+constexpr double LEDBAT_GAIN = 1.0;
+
+PipelineInterestsLedbat::PipelineInterestsLedbat(Face& face, RttEstimatorWithStats& rttEstimator,
+                                                 const Options& opts)
+  : PipelineInterestsAdaptive(face, rttEstimator, opts)
+{
+  afterRttMeasurement.connect([this] (const RttSample& sample) { handleRttSample(sample.rtt); });
+
+  if (m_options.isVerbose) {
+    printOptions();
+    std::cerr << "\tTarget queueing delay = " << m_options.targetDelay << "\n";
+  }
+}
+
+void
+PipelineInterestsLedbat::increaseWindow()
+{
+  // without any delay measurement, behave as if the queue were empty
+  double offTarget = 1.0;
+  if (m_lastRtt != time::nanoseconds::max()) {
+    auto queueingDelay = m_lastRtt - getBaseDelay();
+    offTarget = static_cast<double>((m_options.targetDelay - queueingDelay).count()) /
+                static_cast<double>(time::nanoseconds(m_options.targetDelay).count());
+  }
+
+  // the window grows by at most one segment per RTT, but can shrink much faster
+  m_cwnd = std::max(MIN_CWND, m_cwnd + LEDBAT_GAIN * std::min(offTarget, 1.0) / m_cwnd);
+
+  emitSignal(afterCwndChange, time::steady_clock::now() - getStartTime(), m_cwnd);
+}
+
+void
+PipelineInterestsLedbat::decreaseWindow()
+{
+  m_cwnd = std::max(MIN_CWND, m_cwnd / 2.0);
+
+  emitSignal(afterCwndChange, time::steady_clock::now() - getStartTime(), m_cwnd);
+}
+
+void
+PipelineInterestsLedbat::handleRttSample(time::nanoseconds rtt)
+{
+  m_lastRtt = rtt;
+
+  auto now = time::steady_clock::now();
+  if (m_baseDelays.empty() || now - m_lastRollover >= BASE_INTERVAL) {
+    // start a new interval, forgetting the oldest one
+    m_lastRollover = now;
+    if (m_baseDelays.size() == BASE_HISTORY) {
+      m_baseDelays.pop_front();
+    }
+    m_baseDelays.push_back(rtt);
+  }
+  else {
+    m_baseDelays.back() = std::min(m_baseDelays.back(), rtt);
+  }
+}
+
+time::nanoseconds
+PipelineInterestsLedbat::getBaseDelay() const
+{
+  if (m_baseDelays.empty()) {
+    return time::nanoseconds::max();
+  }
+  return *std::min_element(m_baseDelays.begin(), m_baseDelays.end());
+}
+
+} // namespace ndn::get
@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_PIPELINE_INTERESTS_LEDBAT_HPP
+#define NDN_TOOLS_GET_PIPELINE_INTERESTS_LEDBAT_HPP
+
+#include "pipeline-interests-adaptive.hpp"
+
+#include <deque>
+
+namespace ndn::get {
+
+/**
+ * @brief Implements LEDBAT window increase and decrease.
+ *
+ * A delay-based, less-than-best-effort algorithm: the window grows as long as the queueing delay,
+ * estimated as the latest RTT sample minus the base delay, stays below a target
+ * (Options::targetDelay), and shrinks in proportion to how far the delay exceeds the target.
+ * Packet losses and congestion marks halve the window.
+ *
+ * The base delay is the minimum RTT over the last 10 minutes, kept as one minimum per minute,
+ * so that it follows the path if its propagation delay increases, e.g., after a route change.
+ *
+ * This implementation follows RFC 6817 https://tools.ietf.org/html/rfc6817, using the RTT
+ * in place of the one-way delay, since Interest and Data packets carry no timestamps.
+ */
+class PipelineInterestsLedbat final : public PipelineInterestsAdaptive
+{
+public:
+  PipelineInterestsLedbat(Face& face, RttEstimatorWithStats& rttEstimator, const Options& opts);
+
+private:
+  void
+  increaseWindow() final;
+
+  void
+  decreaseWindow() final;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /**
+   * @brief Record @p rtt as the latest sample and in the base delay history.
+   */
+  void
+  handleRttSample(time::nanoseconds rtt);
+
+  /**
+   * @brief Return the minimum of the base delay history, max() if there is no sample yet.
+   */
+  time::nanoseconds
+  getBaseDelay() const;
+
+  static constexpr double MIN_CWND = 2.0;
+  static constexpr size_t BASE_HISTORY = 10; ///< number of intervals in the base delay history
+  static constexpr time::nanoseconds BASE_INTERVAL = 1_min; ///< duration of each interval
+
+  time::nanoseconds m_lastRtt = time::nanoseconds::max(); ///< latest RTT sample, max() if none yet
+  std::deque<time::nanoseconds> m_baseDelays; ///< minimum RTT of each interval, oldest first
+  time::steady_clock::time_point m_lastRollover; ///< start of the current interval
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_PIPELINE_INTERESTS_LEDBAT_HPP
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "pipeline-interests-multipath.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn::get {
+
+PipelineInterestsMultipath::PipelineInterestsMultipath(Face& face, const Options& opts,
+                                                       std::shared_ptr<const util::RttEstimator::Options> rttOptions,
+                                                       const PathFactory& makePath)
+  : PipelineInterests(face, opts)
+  , m_queue([this] (size_t pathId) { handleLoss(pathId); })
+  , m_paths(opts.forwardingHint.size())
+{
+  BOOST_ASSERT(m_paths.size() >= 2);
+
+  for (size_t i = 0; i < m_paths.size(); ++i) {
+    auto& path = m_paths[i];
+    path.options = opts;
+    path.options.forwardingHint = {opts.forwardingHint[i]};
+    path.options.isQuiet = true;
+    path.rttEstimator = std::make_unique<RttEstimatorWithStats>(rttOptions);
+    path.pipeline = makePath(*path.rttEstimator, path.options);
+    path.pipeline->setSegmentQueue(m_queue, i);
+  }
+}
+
+PipelineInterestsMultipath::~PipelineInterestsMultipath()
+{
+  cancel();
+}
+
+void
+PipelineInterestsMultipath::notifyBacklogReduced()
+{
+  for (auto& path : m_paths) {
+    path.pipeline->notifyBacklogReduced();
+  }
+}
+
+void
+PipelineInterestsMultipath::doRun()
+{
+  if (allSegmentsReceived()) {
+    // the only segment was received during version discovery
+    cancel();
+    if (!m_options.isQuiet) {
+      printSummary();
+    }
+    return;
+  }
+
+  if (auto segNo = getSkippedSegmentNo(); segNo) {
+    m_queue.skipSegment(*segNo);
+  }
+
+  for (size_t i = 0; i < m_paths.size(); ++i) {
+    auto& pipeline = *m_paths[i].pipeline;
+    pipeline.setBacklogCallback(getBacklogCallback());
+    pipeline.run(m_prefix,
+                 [this, i] (const Data& data) { handleData(i, data); },
+                 [this] (const std::string& reason) { onFailure(reason); });
+  }
+}
+
+void
+PipelineInterestsMultipath::doCancel()
+{
+  for (auto& path : m_paths) {
+    path.pipeline->cancel();
+  }
+}
+
+void
+PipelineInterestsMultipath::handleData(size_t pathId, const Data& data)
+{
+  if (isStopping())
+    return;
+
+  if (!m_hasFinalBlockId && data.getFinalBlock()) {
+    m_lastSegmentNo = data.getFinalBlock()->toSegment();
+    m_hasFinalBlockId = true;
+    // the segments are numbered by the shared queue, not by this pipeline
+    uint64_t nRequested = m_queue.getNRequested();
+    m_nOvershoot = nRequested > m_lastSegmentNo + 1 ? nRequested - m_lastSegmentNo - 1 : 0;
+    for (auto& path : m_paths) {
+      path.pipeline->setLastSegmentNo(m_lastSegmentNo);
+    }
+  }
+
+  auto& path = m_paths[pathId];
+  path.nReceived++;
+  path.receivedSize += data.getContent().value_size();
+  onData(data);
+
+  if (allSegmentsReceived()) {
+    cancel();
+    if (!m_options.isQuiet) {
+      printSummary();
+    }
+  }
+}
+
+void
+PipelineInterestsMultipath::handleLoss(size_t)
+{
+  if (m_isWakeUpPending || isStopping())
+    return;
+
+  // the losing pipeline is still processing the loss, so wake up the other paths later
+  m_isWakeUpPending = true;
+  post([this] {
+    m_isWakeUpPending = false;
+    for (auto& path : m_paths) {
+      path.pipeline->sendPendingInterests();
+    }
+  });
+}
+
+void
+PipelineInterestsMultipath::printSummary() const
+{
+  PipelineInterests::printSummary();
+
+  using namespace ndn::time;
+  duration<double, seconds::period> timeElapsed = getElapsedTime();
+  for (size_t i = 0; i < m_paths.size(); ++i) {
+    const auto& path = m_paths[i];
+    double goodput = timeElapsed.count() > 0 ? 8 * path.receivedSize / timeElapsed.count() : 0.0;
+    std::cerr << "Path #" << i << " (" << path.options.forwardingHint.front() << "): "
+              << path.nReceived << " segments"
+              << ", goodput = " << formatThroughput(goodput)
+              << ", cwnd = " << path.pipeline->getWindowState().cwnd;
+    if (path.rttEstimator->getMinRtt() != nanoseconds::max()) {
+      std::cerr << ", avg RTT = " << std::fixed << std::setprecision(3)
+                << path.rttEstimator->getAvgRtt().count() / 1e6 << " ms";
+    }
+    std::cerr << "\n";
+  }
+}
+
+void
+PipelineInterestsMultipath::writeReport(JsonWriter& json) const
+{
+  PipelineInterests::writeReport(json);
+
+  json.beginArray("paths");
+  for (const auto& path : m_paths) {
+    json.beginObject()
+        .member("forwardingHint", path.options.forwardingHint.front().toUri());
+    path.pipeline->writeReport(json);
+    json.endObject();
+  }
+  json.endArray();
+}
+
+} // namespace ndn::get
@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_PIPELINE_INTERESTS_MULTIPATH_HPP
+#define NDN_TOOLS_GET_PIPELINE_INTERESTS_MULTIPATH_HPP
+
+#include "pipeline-interests-adaptive.hpp"
+
+namespace ndn::get {
+
+/**
+ * @brief Service for retrieving Data over several paths at the same time
+ *
+ * Each delegation of Options::forwardingHint is a path, served by its own adaptive pipeline
+ * whose Interests carry only that delegation. Every path has its own RTT estimator and
+ * congestion window, and takes the next segment from a shared SegmentQueue whenever its window
+ * allows, so a path receives segments in proportion to its throughput. A segment that times out
+ * or is Nacked on one path is retransmitted on another one.
+ *
+ * The segments of all paths are delivered through a single callback, as if they came from
+ * one pipeline.
+ */
+class PipelineInterestsMultipath final : public PipelineInterests
+{
+public:
+  using PathFactory = std::function<std::unique_ptr<PipelineInterestsAdaptive>(
+                                      RttEstimatorWithStats& rttEstimator, const Options& opts)>;
+
+  /**
+   * @param opts options of the transfer; must contain at least two forwarding hint delegations
+   * @param rttOptions options of the RTT estimator of every path
+   * @param makePath creates the pipeline of each path
+   */
+  PipelineInterestsMultipath(Face& face, const Options& opts,
+                             std::shared_ptr<const util::RttEstimator::Options> rttOptions,
+                             const PathFactory& makePath);
+
+  ~PipelineInterestsMultipath() final;
+
+  void
+  notifyBacklogReduced() final;
+
+  void
+  writeReport(JsonWriter& json) const final;
+
+private:
+  void
+  doRun() final;
+
+  void
+  doCancel() final;
+
+  void
+  handleData(size_t pathId, const Data& data);
+
+  /**
+   * @brief Let the other paths retransmit a segment lost on path @p pathId, even if they are idle
+   */
+  void
+  handleLoss(size_t pathId);
+
+  void
+  printSummary() const final;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  struct Path
+  {
+    Options options; ///< same as the transfer options, but with a single delegation
+    std::unique_ptr<RttEstimatorWithStats> rttEstimator;
+    std::unique_ptr<PipelineInterestsAdaptive> pipeline;
+    uint64_t nReceived = 0;
+    size_t receivedSize = 0;
+  };
+
+  SegmentQueue m_queue;
+  std::vector<Path> m_paths; ///< never resized after construction, the pipelines refer to the options
+  bool m_isWakeUpPending = false;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_PIPELINE_INTERESTS_MULTIPATH_HPP
@@ -0,0 +1,168 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "pipeline-interests-striped.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn::get {
+
+PipelineInterestsStriped::PipelineInterestsStriped(Face& face, const Options& opts, size_t nStreams,
+                                                   std::shared_ptr<const util::RttEstimator::Options> rttOptions,
+                                                   const StreamFactory& makeStream)
+  : PipelineInterests(face, opts)
+  , m_streamOptions(opts)
+{
+  BOOST_ASSERT(nStreams > 0);
+  m_streamOptions.isQuiet = true;
+
+  m_streams.resize(nStreams);
+  for (auto& stream : m_streams) {
+    stream.rttEstimator = std::make_unique<RttEstimatorWithStats>(rttOptions);
+    stream.pipeline = makeStream(*stream.rttEstimator, m_streamOptions);
+  }
+
+  if (m_options.isVerbose) {
+    std::cerr << "\tNumber of streams = " << nStreams << "\n";
+  }
+}
+
+PipelineInterestsStriped::~PipelineInterestsStriped()
+{
+  cancel();
+}
+
+void
+PipelineInterestsStriped::notifyBacklogReduced()
+{
+  for (auto& stream : m_streams) {
+    stream.pipeline->notifyBacklogReduced();
+  }
+}
+
+uint64_t
+PipelineInterestsStriped::getNOvershoot() const
+{
+  uint64_t nOvershoot = 0;
+  for (const auto& stream : m_streams) {
+    nOvershoot += stream.pipeline->getNOvershoot();
+  }
+  return nOvershoot;
+}
+
+void
+PipelineInterestsStriped::doRun()
+{
+  if (allSegmentsReceived()) {
+    // the only segment was received during version discovery
+    cancel();
+    if (!m_options.isQuiet) {
+      printSummary();
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < m_streams.size(); ++i) {
+    auto& pipeline = *m_streams[i].pipeline;
+    pipeline.setStripe(i, m_streams.size());
+    if (auto segNo = getSkippedSegmentNo(); segNo && *segNo % m_streams.size() == i) {
+      pipeline.skipSegment(*segNo);
+    }
+    // every stream is paused when the consumer's backlog of all streams reaches the limit
+    pipeline.setBacklogCallback(getBacklogCallback());
+    if (m_hasFinalBlockId) {
+      pipeline.setLastSegmentNoHint(m_lastSegmentNo);
+    }
+    pipeline.run(m_prefix,
+                 [this, i] (const Data& data) { handleData(i, data); },
+                 [this] (const std::string& reason) { onFailure(reason); });
+  }
+}
+
+void
+PipelineInterestsStriped::doCancel()
+{
+  for (auto& stream : m_streams) {
+    stream.pipeline->cancel();
+  }
+}
+
+void
+PipelineInterestsStriped::handleData(size_t streamNo, const Data& data)
+{
+  if (isStopping())
+    return;
+
+  if (!m_hasFinalBlockId && data.getFinalBlock()) {
+    m_lastSegmentNo = data.getFinalBlock()->toSegment();
+    m_hasFinalBlockId = true;
+    for (auto& stream : m_streams) {
+      stream.pipeline->setLastSegmentNo(m_lastSegmentNo);
+    }
+  }
+
+  m_streams[streamNo].nReceived++;
+  onData(data);
+
+  if (allSegmentsReceived()) {
+    cancel();
+    if (!m_options.isQuiet) {
+      printSummary();
+    }
+  }
+}
+
+void
+PipelineInterestsStriped::printSummary() const
+{
+  PipelineInterests::printSummary();
+
+  for (size_t i = 0; i < m_streams.size(); ++i) {
+    const auto& stream = m_streams[i];
+    std::cerr << "Stream #" << i << ": " << stream.nReceived << " segments"
+              << ", cwnd = " << stream.pipeline->getWindowState().cwnd;
+    if (stream.rttEstimator->getMinRtt() != time::nanoseconds::max()) {
+      std::cerr << ", avg RTT = " << std::fixed << std::setprecision(3)
+                << stream.rttEstimator->getAvgRtt().count() / 1e6 << " ms";
+    }
+    std::cerr << "\n";
+  }
+}
+
+void
+PipelineInterestsStriped::writeReport(JsonWriter& json) const
+{
+  PipelineInterests::writeReport(json);
+
+  json.beginArray("streams");
+  for (const auto& stream : m_streams) {
+    json.beginObject();
+    stream.pipeline->writeReport(json);
+    json.endObject();
+  }
+  json.endArray();
+}
+
+} // namespace ndn::get
@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_PIPELINE_INTERESTS_STRIPED_HPP
+#define NDN_TOOLS_GET_PIPELINE_INTERESTS_STRIPED_HPP
+
+#include "pipeline-interests-adaptive.hpp"
+
+namespace ndn::get {
+
+/**
+ * @brief Service for retrieving Data via several parallel Interest pipelines
+ *
+ * The segments of the content are split among N adaptive pipelines (streams): stream i fetches
+ * the segments whose number modulo N is i. Each stream has its own RTT estimator, congestion
+ * window, and retransmission state, so that a single loss or RTT spike only slows down one of
+ * them. The segments of all streams are delivered through a single callback, as if they came
+ * from one pipeline.
+ *
+ * The last segment number learned by any stream is passed on to the others.
+ */
+class PipelineInterestsStriped final : public PipelineInterests
+{
+public:
+  using StreamFactory = std::function<std::unique_ptr<PipelineInterestsAdaptive>(
+                                        RttEstimatorWithStats& rttEstimator, const Options& opts)>;
+
+  /**
+   * @param nStreams number of streams, must be at least 1
+   * @param rttOptions options of the RTT estimator of every stream
+   * @param makeStream creates the pipeline of each stream
+   */
+  PipelineInterestsStriped(Face& face, const Options& opts, size_t nStreams,
+                           std::shared_ptr<const util::RttEstimator::Options> rttOptions,
+                           const StreamFactory& makeStream);
+
+  ~PipelineInterestsStriped() final;
+
+  void
+  notifyBacklogReduced() final;
+
+  void
+  writeReport(JsonWriter& json) const final;
+
+  uint64_t
+  getNOvershoot() const final;
+
+private:
+  void
+  doRun() final;
+
+  void
+  doCancel() final;
+
+  void
+  handleData(size_t streamNo, const Data& data);
+
+  void
+  printSummary() const final;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  struct Stream
+  {
+    std::unique_ptr<RttEstimatorWithStats> rttEstimator;
+    std::unique_ptr<PipelineInterestsAdaptive> pipeline;
+    uint64_t nReceived = 0;
+  };
+
+  Options m_streamOptions; ///< same as m_options, but the streams do not print their own summary
+  std::vector<Stream> m_streams;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_PIPELINE_INTERESTS_STRIPED_HPP
@@ -31,9 +31,6 @@
 #include "pipeline-interests.hpp"
 #include "data-fetcher.hpp"
 
-#include <boost/asio/io_context.hpp>
-#include <boost/asio/post.hpp>
-
 #include <iostream>
 
 namespace ndn::get {
@@ -44,7 +41,13 @@ PipelineInterests::PipelineInterests(Face& face, const Options& opts)
 {
 }
 
-PipelineInterests::~PipelineInterests() = default;
+PipelineInterests::~PipelineInterests()
+{
+  // doCancel() cannot be dispatched from here, subclasses call cancel() in their own destructor;
+  // stop anyway and drop the handlers that are still queued in the I/O context
+  m_isStopping = true;
+  m_aliveToken.reset();
+}
 
 void
 PipelineInterests::run(const Name& versionedName, DataCallback dataCb, FailureCallback failureCb)
@@ -60,9 +63,67 @@ PipelineInterests::run(const Name& versionedName, DataCallback dataCb, FailureCa
   // record the start time of the pipeline
   m_startTime = time::steady_clock::now();
 
+  if (m_prefetchedData != nullptr) {
+    auto data = std::move(m_prefetchedData);
+    if (!m_hasFinalBlockId && data->getFinalBlock()) {
+      recordFinalBlockId(data->getFinalBlock()->toSegment());
+    }
+    onData(*data);
+    if (m_isStopping) {
+      // the consumer gave up while handling the segment
+      return;
+    }
+  }
+
   doRun();
 }
 
+void
+PipelineInterests::resumeFrom(uint64_t lastSegmentNo, SegmentPredicate isReceived, uint64_t nReceived)
+{
+  BOOST_ASSERT(nReceived <= lastSegmentNo + 1);
+  BOOST_ASSERT(m_stripeCount == 1);
+
+  m_hasFinalBlockId = true;
+  m_lastSegmentNo = lastSegmentNo;
+  m_isPreviouslyReceived = std::move(isReceived);
+  m_nPreviouslyReceived = nReceived;
+}
+
+void
+PipelineInterests::setStripe(uint64_t index, uint64_t count)
+{
+  BOOST_ASSERT(count > 0 && index < count);
+  BOOST_ASSERT(!m_isPreviouslyReceived);
+
+  m_stripeIndex = index;
+  m_stripeCount = count;
+  m_nextSegmentNo = index;
+}
+
+void
+PipelineInterests::setLastSegmentNoHint(uint64_t lastSegmentNo)
+{
+  if (!m_options.probeFinalBlockId || m_hasFinalBlockId)
+    return;
+
+  m_hasFinalBlockId = true;
+  m_lastSegmentNo = lastSegmentNo;
+}
+
+void
+PipelineInterests::setPrefetchedSegment(std::shared_ptr<const Data> data)
+{
+  BOOST_ASSERT(data != nullptr);
+
+  uint64_t segNo = getSegmentFromPacket(*data);
+  if (m_isPreviouslyReceived && segNo <= m_lastSegmentNo && m_isPreviouslyReceived(segNo))
+    return;
+
+  m_prefetchedData = std::move(data);
+  m_skippedSegNo = segNo;
+}
+
 void
 PipelineInterests::cancel()
 {
@@ -70,21 +131,114 @@ PipelineInterests::cancel()
     return;
 
   m_isStopping = true;
+  recordEndTime();
   doCancel();
 }
 
 bool
 PipelineInterests::allSegmentsReceived() const
 {
-  return m_nReceived > 0 &&
-         m_hasFinalBlockId &&
-         static_cast<uint64_t>(m_nReceived - 1) >= m_lastSegmentNo;
+  if (!m_hasFinalBlockId)
+    return false;
+
+  uint64_t nReceived = static_cast<uint64_t>(m_nReceived) + m_nPreviouslyReceived;
+  uint64_t nSegments = m_lastSegmentNo < m_stripeIndex ?
+                       0 : (m_lastSegmentNo - m_stripeIndex) / m_stripeCount + 1;
+  return nReceived >= nSegments;
 }
 
 uint64_t
 PipelineInterests::getNextSegmentNo()
 {
-  return m_nextSegmentNo++;
+  auto isSkipped = [this] (uint64_t segNo) {
+    return segNo == m_skippedSegNo ||
+           (m_isPreviouslyReceived && segNo <= m_lastSegmentNo && m_isPreviouslyReceived(segNo));
+  };
+  while (isSkipped(m_nextSegmentNo)) {
+    m_nextSegmentNo += m_stripeCount;
+  }
+  uint64_t segNo = m_nextSegmentNo;
+  m_nextSegmentNo += m_stripeCount;
+  return segNo;
+}
+
+Interest
+PipelineInterests::makeInterest(uint64_t segNo, time::milliseconds lifetime) const
+{
+  Interest interest(Name(m_prefix).appendSegment(segNo));
+  interest.setMustBeFresh(m_options.mustBeFresh)
+          .setForwardingHint(m_options.forwardingHint)
+          .setInterestLifetime(lifetime);
+  return interest;
+}
+
+bool
+PipelineInterests::canRequestNewSegment()
+{
+  if (m_options.probeFinalBlockId && !m_hasFinalBlockId &&
+      getStripeOffset(m_nextSegmentNo) >= m_probeLimit) {
+    // wait for the FinalBlockId, or for a segment without one to raise the limit
+    return false;
+  }
+
+  if (m_options.maxBufferSize == 0 || !m_getBacklog)
+    return true;
+
+  bool isFull = m_getBacklog() >= m_options.maxBufferSize;
+  if (isFull && !m_isBackpressured) {
+    m_isBackpressured = true;
+    m_backpressureStart = time::steady_clock::now();
+    m_nBackpressureStalls++;
+    if (m_options.isVerbose) {
+      std::cerr << "Reorder buffer full, pausing requests for new segments\n";
+    }
+  }
+  else if (!isFull && m_isBackpressured) {
+    m_isBackpressured = false;
+    m_backpressureTime += time::steady_clock::now() - m_backpressureStart;
+  }
+  return !isFull;
+}
+
+void
+PipelineInterests::recordFinalBlockId(uint64_t lastSegmentNo)
+{
+  BOOST_ASSERT(!m_hasFinalBlockId);
+  m_hasFinalBlockId = true;
+  m_lastSegmentNo = lastSegmentNo;
+
+  uint64_t nRequested = getStripeOffset(m_nextSegmentNo);
+  uint64_t nSegments = lastSegmentNo < m_stripeIndex ? 0 : getStripeOffset(lastSegmentNo) + 1;
+  m_nOvershoot = nRequested > nSegments ? nRequested - nSegments : 0;
+
+  if (m_options.probeFinalBlockId) {
+    scheduleResume();
+  }
+}
+
+void
+PipelineInterests::notifyBacklogReduced()
+{
+  if (!m_isBackpressured)
+    return;
+
+  scheduleResume();
+}
+
+void
+PipelineInterests::scheduleResume()
+{
+  if (m_isResumePending || m_isStopping)
+    return;
+
+  // the consumer may be running inside our own onData() callback, so resume later
+  m_isResumePending = true;
+  post([this] {
+    m_isResumePending = false;
+    if (!m_isStopping) {
+      doResume();
+    }
+  });
 }
 
 void
@@ -92,6 +246,18 @@ PipelineInterests::onData(const Data& data)
 {
   m_nReceived++;
   m_receivedSize += data.getContent().value_size();
+  if (allSegmentsReceived()) {
+    recordEndTime();
+  }
+
+  if (m_options.probeFinalBlockId && !m_hasFinalBlockId && !data.getFinalBlock()) {
+    // the content extends at least this far, request up to twice as many segments
+    uint64_t limit = 2 * (getStripeOffset(getSegmentFromPacket(data)) + 1);
+    if (limit > m_probeLimit) {
+      m_probeLimit = limit;
+      scheduleResume();
+    }
+  }
 
   m_onData(data);
 }
@@ -105,7 +271,7 @@ PipelineInterests::onFailure(const std::string& reason)
   cancel();
 
   if (m_onFailure) {
-    boost::asio::post(m_face.getIoContext(), [this, reason] { m_onFailure(reason); });
+    post([this, reason] { m_onFailure(reason); });
   }
 }
 
@@ -117,21 +283,84 @@ PipelineInterests::printOptions() const
             << "\tInterest lifetime = " << m_options.interestLifetime << "\n"
             << "\tMax retries on timeout or Nack = " <<
                (m_options.maxRetriesOnTimeoutOrNack == DataFetcher::MAX_RETRIES_INFINITE ?
-                  "infinite" : std::to_string(m_options.maxRetriesOnTimeoutOrNack)) << "\n";
+                  "infinite" : std::to_string(m_options.maxRetriesOnTimeoutOrNack)) << "\n"
+            << "\tMax buffered segments = " <<
+               (m_options.maxBufferSize == 0 ? "unlimited" : std::to_string(m_options.maxBufferSize)) << "\n"
+            << "\tProbe for the last segment = " << (m_options.probeFinalBlockId ? "yes" : "no") << "\n";
+  for (const auto& delegation : m_options.forwardingHint) {
+    std::cerr << "\tForwarding hint = " << delegation << "\n";
+  }
 }
 
 void
 PipelineInterests::printSummary() const
 {
   using namespace ndn::time;
-  duration<double, seconds::period> timeElapsed = steady_clock::now() - getStartTime();
-  double throughput = 8 * m_receivedSize / timeElapsed.count();
+  duration<double, seconds::period> timeElapsed = getElapsedTime();
+  double throughput = timeElapsed.count() > 0 ? 8 * m_receivedSize / timeElapsed.count() : 0.0;
 
   std::cerr << "\n\nAll segments have been received.\n"
             << "Time elapsed: " << timeElapsed << "\n"
-            << "Segments received: " << m_nReceived << "\n"
-            << "Transferred size: " << m_receivedSize / 1e3 << " kB" << "\n"
-            << "Goodput: " << formatThroughput(throughput) << "\n";
+            << "Segments received: " << m_nReceived << "\n";
+  if (m_nPreviouslyReceived > 0) {
+    std::cerr << "Segments resumed from a previous run: " << m_nPreviouslyReceived << "\n";
+  }
+  std::cerr << "Transferred size: " << m_receivedSize / 1e3 << " kB" << "\n"
+            << "Goodput: " << formatThroughput(throughput) << "\n"
+            << "Segments requested beyond the last one: " << getNOvershoot() << "\n";
+
+  if (m_options.maxBufferSize > 0) {
+    auto stallTime = m_backpressureTime;
+    if (m_isBackpressured) {
+      stallTime += getEndTime() - m_backpressureStart;
+    }
+    std::cerr << "Backpressure stalls: " << m_nBackpressureStalls
+              << " (total " << duration_cast<milliseconds>(stallTime) << ")\n";
+  }
+}
+
+void
+PipelineInterests::writeReport(JsonWriter& json) const
+{
+  using namespace ndn::time;
+  duration<double, seconds::period> timeElapsed = getElapsedTime();
+  auto stallTime = m_backpressureTime;
+  if (m_isBackpressured) {
+    stallTime += getEndTime() - m_backpressureStart;
+  }
+
+  json.member("elapsedSeconds", timeElapsed.count())
+      .member("segmentsReceived", m_nReceived)
+      .member("segmentsResumed", m_nPreviouslyReceived)
+      .member("bytesReceived", m_receivedSize)
+      .member("goodputBitsPerSecond", timeElapsed.count() > 0 ? 8 * m_receivedSize / timeElapsed.count() : 0.0)
+      .member("segmentsBeyondEnd", getNOvershoot())
+      .member("backpressureStalls", m_nBackpressureStalls)
+      .member("backpressureSeconds", duration<double, seconds::period>(stallTime).count());
+}
+
+time::nanoseconds
+PipelineInterests::getElapsedTime() const
+{
+  if (m_startTime == time::steady_clock::time_point{}) {
+    // the pipeline has not been started, e.g., because version discovery failed
+    return 0_ns;
+  }
+  return getEndTime() - m_startTime;
+}
+
+time::steady_clock::time_point
+PipelineInterests::getEndTime() const
+{
+  return m_endTime == time::steady_clock::time_point{} ? time::steady_clock::now() : m_endTime;
+}
+
+void
+PipelineInterests::recordEndTime()
+{
+  if (m_endTime == time::steady_clock::time_point{}) {
+    m_endTime = time::steady_clock::now();
+  }
 }
 
 std::string
@@ -32,11 +32,16 @@
 #define NDN_TOOLS_GET_PIPELINE_INTERESTS_HPP
 
 #include "core/common.hpp"
+#include "json-writer.hpp"
 #include "options.hpp"
 
 #include <ndn-cxx/face.hpp>
 
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
 #include <functional>
+#include <optional>
 
 namespace ndn::get {
 
@@ -66,6 +71,8 @@ public:
 
   using DataCallback = std::function<void(const Data&)>;
   using FailureCallback = std::function<void(const std::string& reason)>;
+  using BacklogCallback = std::function<size_t()>;
+  using SegmentPredicate = std::function<bool(uint64_t segNo)>;
 
   /**
    * @brief start fetching all the segments of the specified prefix
@@ -77,12 +84,117 @@ public:
   void
   run(const Name& versionedName, DataCallback onData, FailureCallback onFailure);
 
+  /**
+   * @brief Resume a partially completed transfer of a content whose last segment is known.
+   *
+   * Must be called before run(). The segments for which @p isReceived returns true are never
+   * requested and are counted as already received, so that the pipeline starts at the first
+   * missing segment.
+   *
+   * @param lastSegmentNo the last segment number of the content
+   * @param isReceived returns whether a segment has been received in a previous run
+   * @param nReceived number of segments for which @p isReceived returns true
+   */
+  void
+  resumeFrom(uint64_t lastSegmentNo, SegmentPredicate isReceived, uint64_t nReceived);
+
+  /**
+   * @brief Only fetch one stripe of the content: every @p count-th segment, starting at @p index.
+   *
+   * Used to split the segments of an object among several pipelines. The transfer is complete
+   * once all the segments of the stripe have been received. Must be called before run(),
+   * and cannot be combined with resumeFrom().
+   */
+  void
+  setStripe(uint64_t index, uint64_t count);
+
+  /**
+   * @brief Learn the last segment number of the content before the first segment arrives,
+   *        e.g., from the FinalBlockId of the Data that revealed the version.
+   *
+   * Ignored unless Options::probeFinalBlockId is set. Must be called before run().
+   */
+  void
+  setLastSegmentNoHint(uint64_t lastSegmentNo);
+
+  /**
+   * @brief Take @p data, a segment received before the pipeline started, e.g., by the
+   *        CanBePrefix Interest of version discovery, as part of the transfer.
+   *
+   * run() delivers it before requesting any segment, and it is never requested. Ignored if
+   * the segment has been received in a previous run. Must be called before run().
+   */
+  void
+  setPrefetchedSegment(std::shared_ptr<const Data> data);
+
+  /**
+   * @brief Never request segment @p segNo, which has been obtained by other means.
+   *
+   * Used by pipelines that split a transfer among several pipelines. Must be called before run().
+   */
+  void
+  skipSegment(uint64_t segNo)
+  {
+    m_skippedSegNo = segNo;
+  }
+
   /**
    * @brief stop all fetch operations
    */
   void
   cancel();
 
+  /**
+   * @brief Return the largest number of Interests that can be in flight at the same time.
+   *
+   * Used as a sizing hint by the consumer's reorder buffer.
+   * The default implementation returns 0, meaning that the window size is unbounded.
+   */
+  virtual size_t
+  getMaxWindowSize() const
+  {
+    return 0;
+  }
+
+  /**
+   * @brief Return the number of segments requested beyond the last segment of the content
+   *        before its FinalBlockId was received.
+   */
+  virtual uint64_t
+  getNOvershoot() const
+  {
+    return m_nOvershoot;
+  }
+
+  /**
+   * @brief Set the function used to query the consumer's reorder backlog.
+   *
+   * @p cb must return the number of segments that have been received but not yet consumed.
+   * If Options::maxBufferSize is non-zero, no new segments are requested while the backlog
+   * is at or above that limit; retransmissions are not affected.
+   */
+  void
+  setBacklogCallback(BacklogCallback cb)
+  {
+    m_getBacklog = std::move(cb);
+  }
+
+  /**
+   * @brief Notify the pipeline that the consumer's reorder backlog has shrunk.
+   *
+   * If the pipeline is currently stalled because of backpressure, it is resumed asynchronously.
+   */
+  virtual void
+  notifyBacklogReduced();
+
+  /**
+   * @brief Write the statistics of this fetching session as members of the current JSON object.
+   *
+   * Subclasses can override this method to add their own statistics.
+   */
+  virtual void
+  writeReport(JsonWriter& json) const;
+
 protected:
   time::steady_clock::time_point
   getStartTime() const
@@ -96,6 +208,24 @@ protected:
     return m_isStopping;
   }
 
+  uint64_t
+  getStripeIndex() const
+  {
+    return m_stripeIndex;
+  }
+
+  uint64_t
+  getStripeCount() const
+  {
+    return m_stripeCount;
+  }
+
+  const BacklogCallback&
+  getBacklogCallback() const
+  {
+    return m_getBacklog;
+  }
+
   /**
    * @brief check if the transfer is complete
    * @return true if all segments have been received, false otherwise
@@ -104,12 +234,48 @@ protected:
   allSegmentsReceived() const;
 
   /**
-   * @return next segment number to retrieve
-   * @post m_nextSegmentNo == return-value + 1
+   * @brief Return the segment that is never requested, if any
+   */
+  std::optional<uint64_t>
+  getSkippedSegmentNo() const
+  {
+    return m_skippedSegNo;
+  }
+
+  /**
+   * @return next segment number of the stripe to retrieve, skipping the segments received
+   *         in a previous run or obtained by other means
+   * @post m_nextSegmentNo == return-value + stripe count
    */
   uint64_t
   getNextSegmentNo();
 
+  /**
+   * @brief check whether a new (i.e., not a retransmitted) segment can be requested
+   *
+   * Also keeps track of the time spent stalled because of backpressure from the consumer.
+   * @return false if the consumer's backlog has reached Options::maxBufferSize, or if
+   *         Options::probeFinalBlockId is set and the next segment is beyond the probing limit
+   */
+  bool
+  canRequestNewSegment();
+
+  /**
+   * @brief subclasses must call this method when they learn the last segment number of the content
+   *
+   * Records how many segments beyond the last one have been requested, and resumes the requests
+   * held back while probing for the FinalBlockId.
+   * @pre m_hasFinalBlockId is false
+   */
+  void
+  recordFinalBlockId(uint64_t lastSegmentNo);
+
+  /**
+   * @brief Create the Interest for segment @p segNo of m_prefix, with the given @p lifetime
+   */
+  Interest
+  makeInterest(uint64_t segNo, time::milliseconds lifetime) const;
+
   /**
    * @brief subclasses must call this method to notify successful retrieval of a segment
    */
@@ -133,12 +299,40 @@ protected:
   virtual void
   printSummary() const;
 
+  /**
+   * @brief Invoke @p handler asynchronously on the I/O thread, unless the pipeline
+   *        has been destroyed in the meantime
+   */
+  template<typename Handler>
+  void
+  post(Handler&& handler)
+  {
+    boost::asio::post(m_face.getIoContext(),
+                      [token = std::weak_ptr<void>(m_aliveToken),
+                       handler = std::forward<Handler>(handler)] {
+                        if (!token.expired()) {
+                          handler();
+                        }
+                      });
+  }
+
   /**
    * @param throughput The throughput in bits/s
    */
   static std::string
   formatThroughput(double throughput);
 
+  /**
+   * @brief Return the time elapsed between run() and m_endTime, or until now if still running
+   *
+   * Used by both the printed summary and the JSON report, so that they agree.
+   */
+  time::nanoseconds
+  getElapsedTime() const;
+
+  time::steady_clock::time_point
+  getEndTime() const;
+
 private:
   /**
    * @brief perform subclass-specific operations to fetch all the segments
@@ -155,6 +349,35 @@ private:
   virtual void
   doCancel() = 0;
 
+  /**
+   * @brief resume requesting new segments after a backpressure stall, or after the FinalBlockId
+   *        probing limit has been raised
+   *
+   * The default implementation does nothing.
+   */
+  virtual void
+  doResume()
+  {
+  }
+
+  /**
+   * @brief Resume the pipeline asynchronously, unless a resumption is already pending
+   */
+  void
+  scheduleResume();
+
+  void
+  recordEndTime();
+
+  /**
+   * @brief Return the position of segment @p segNo within the stripe
+   */
+  uint64_t
+  getStripeOffset(uint64_t segNo) const
+  {
+    return (segNo - m_stripeIndex) / m_stripeCount;
+  }
+
 protected:
   const Options& m_options;
   Face& m_face;
@@ -164,14 +387,35 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   bool m_hasFinalBlockId = false; ///< true if the last segment number is known
   uint64_t m_lastSegmentNo = 0;   ///< valid only if m_hasFinalBlockId == true
   int64_t m_nReceived = 0;        ///< number of segments received
+  uint64_t m_nOvershoot = 0;      ///< number of segments requested beyond the last one
   size_t m_receivedSize = 0;      ///< size of received data in bytes
 
 private:
   DataCallback m_onData;
   FailureCallback m_onFailure;
+  BacklogCallback m_getBacklog;
+  SegmentPredicate m_isPreviouslyReceived;
+  uint64_t m_nPreviouslyReceived = 0; ///< number of segments received in a previous run
+  std::shared_ptr<const Data> m_prefetchedData; ///< delivered by run(), then reset
+  std::optional<uint64_t> m_skippedSegNo; ///< segment that is never requested
   uint64_t m_nextSegmentNo = 0;
+  uint64_t m_stripeIndex = 0;
+  uint64_t m_stripeCount = 1;
+  std::shared_ptr<void> m_aliveToken = std::make_shared<int>(); ///< reset by the destructor to
+                                                                 ///< invalidate pending handlers
   time::steady_clock::time_point m_startTime;
+  time::steady_clock::time_point m_endTime; ///< when all segments were received or the pipeline
+                                            ///< was cancelled, zero if neither has happened yet
   bool m_isStopping = false;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  bool m_isBackpressured = false; ///< true if new segments are not requested because of backpressure
+  bool m_isResumePending = false;
+  int64_t m_nBackpressureStalls = 0; ///< # of times the pipeline stalled because of backpressure
+  time::steady_clock::time_point m_backpressureStart; ///< start of the current stall
+  time::nanoseconds m_backpressureTime = 0_ns; ///< total time spent stalled because of backpressure
+  uint64_t m_probeLimit = 1; ///< with Options::probeFinalBlockId, number of segments of the stripe
+                             ///< that can be requested until the last segment number is known
 };
 
 template<typename Packet>
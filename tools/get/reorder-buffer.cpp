@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "reorder-buffer.hpp"
+
+#include <algorithm>
+
+namespace ndn::get {
+
+static size_t
+roundUpToPowerOfTwo(size_t n)
+{
+  size_t p = 1;
+  while (p < n) {
+    p <<= 1;
+  }
+  return p;
+}
+
+ReorderBuffer::ReorderBuffer(size_t capacity)
+{
+  reset(capacity);
+}
+
+void
+ReorderBuffer::reset(size_t capacity, uint64_t nextSegNo)
+{
+  m_slots.clear();
+  m_slots.resize(roundUpToPowerOfTwo(std::max<size_t>(capacity, 1)));
+  m_mask = m_slots.size() - 1;
+  m_head = 0;
+  m_nextSegNo = nextSegNo;
+  m_size = 0;
+  m_highWaterMark = 0;
+}
+
+bool
+ReorderBuffer::insert(uint64_t segNo, std::shared_ptr<const Data> data)
+{
+  BOOST_ASSERT(data != nullptr);
+
+  if (segNo < m_nextSegNo) {
+    return false;
+  }
+
+  uint64_t offset = segNo - m_nextSegNo;
+  if (offset >= m_slots.size()) {
+    grow(static_cast<size_t>(offset) + 1);
+  }
+
+  auto& slot = m_slots[(m_head + offset) & m_mask];
+  if (slot != nullptr) {
+    return false;
+  }
+
+  slot = std::move(data);
+  ++m_size;
+  m_highWaterMark = std::max(m_highWaterMark, m_size);
+  return true;
+}
+
+void
+ReorderBuffer::grow(size_t minCapacity)
+{
+  std::vector<std::shared_ptr<const Data>> slots(roundUpToPowerOfTwo(minCapacity));
+  for (size_t i = 0; i < m_slots.size(); ++i) {
+    slots[i] = std::move(m_slots[(m_head + i) & m_mask]);
+  }
+
+  m_slots = std::move(slots);
+  m_mask = m_slots.size() - 1;
+  m_head = 0;
+}
+
+} // namespace ndn::get
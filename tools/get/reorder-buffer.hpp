@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_REORDER_BUFFER_HPP
+#define NDN_TOOLS_GET_REORDER_BUFFER_HPP
+
+#include "core/common.hpp"
+
+#include <vector>
+
+namespace ndn::get {
+
+/**
+ * @brief Circular buffer that restores the order of segments received out of order.
+ *
+ * A segment is stored in the slot at distance `segNo - getNextSegmentNo()` from the head of
+ * the ring, so insertion and removal are O(1) and do not allocate. The capacity is always a
+ * power of two; it is doubled if a segment arrives beyond the end of the current window,
+ * which can only happen if the sizing hint was smaller than the actual reordering distance.
+ */
+class ReorderBuffer : noncopyable
+{
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+  explicit
+  ReorderBuffer(size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * @brief Discard all buffered segments and restart from segment @p nextSegNo.
+   * @param capacity sizing hint, rounded up to the next power of two
+   */
+  void
+  reset(size_t capacity, uint64_t nextSegNo = 0);
+
+  /**
+   * @brief Store a segment until all of its predecessors have been received.
+   * @return false if the segment has already been delivered or is already buffered
+   */
+  bool
+  insert(uint64_t segNo, std::shared_ptr<const Data> data);
+
+  /**
+   * @brief Remove the run of contiguous segments starting at getNextSegmentNo().
+   *
+   * @p func is invoked in order on every removed segment, with a `std::shared_ptr<const Data>`
+   * argument whose ownership is transferred to the callee.
+   * @return the number of segments removed
+   */
+  template<typename Func>
+  size_t
+  drain(Func&& func)
+  {
+    size_t nDrained = 0;
+    while (m_slots[m_head] != nullptr) {
+      auto data = std::move(m_slots[m_head]);
+      m_slots[m_head] = nullptr;
+      m_head = (m_head + 1) & m_mask;
+      ++m_nextSegNo;
+      ++nDrained;
+      func(std::move(data));
+    }
+    m_size -= nDrained;
+    return nDrained;
+  }
+
+  /**
+   * @brief Return the number of the first segment that has not been drained yet.
+   */
+  uint64_t
+  getNextSegmentNo() const
+  {
+    return m_nextSegNo;
+  }
+
+  /**
+   * @brief Return the number of segments currently buffered.
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_slots.size();
+  }
+
+  /**
+   * @brief Return the largest number of segments that were buffered at the same time.
+   */
+  size_t
+  getHighWaterMark() const
+  {
+    return m_highWaterMark;
+  }
+
+private:
+  void
+  grow(size_t minCapacity);
+
+private:
+  std::vector<std::shared_ptr<const Data>> m_slots;
+  size_t m_mask = 0;            ///< m_slots.size() - 1
+  size_t m_head = 0;            ///< index of the slot holding segment m_nextSegNo
+  uint64_t m_nextSegNo = 0;
+  size_t m_size = 0;
+  size_t m_highWaterMark = 0;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_REORDER_BUFFER_HPP
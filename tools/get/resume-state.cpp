@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "resume-state.hpp"
+
+#include <ndn-cxx/util/exception.hpp>
+
+#include <bitset>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace ndn::get {
+
+namespace {
+
+constexpr char MAGIC[8] = {'N', 'D', 'N', 'G', 'E', 'T', 'R', '\x01'};
+
+/// The bitmap starts at this offset, which is a multiple of the page size on all supported
+/// platforms, as required by mmap(). The unused part of the header is not allocated on disk.
+constexpr size_t HEADER_SIZE = 65536;
+
+struct Header
+{
+  char magic[8];
+  uint64_t lastSegmentNo;
+  uint64_t segmentSize;
+  uint32_t hasLayout;   ///< non-zero if lastSegmentNo and segmentSize are valid
+  uint32_t nameSize;    ///< size of the versioned name encoding that follows the header
+};
+
+} // namespace
+
+ResumeState::ResumeState(const std::string& path)
+  : m_path(path)
+{
+  m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+  if (m_fd < 0) {
+    NDN_THROW(Error("Cannot open '" + path + "': " + std::strerror(errno)));
+  }
+
+  try {
+    load();
+  }
+  catch (const Error&) {
+    ::close(m_fd);
+    throw;
+  }
+}
+
+ResumeState::~ResumeState()
+{
+  unmapBitmap();
+  ::close(m_fd);
+}
+
+void
+ResumeState::load()
+{
+  Header header{};
+  ssize_t n = ::pread(m_fd, &header, sizeof(header), 0);
+  if (n == 0) {
+    return; // new file
+  }
+  if (n != sizeof(header) || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header.nameSize > HEADER_SIZE - sizeof(header)) {
+    NDN_THROW(Error("'" + m_path + "' is not a valid ndnget state file"));
+  }
+
+  std::vector<uint8_t> nameWire(header.nameSize);
+  if (::pread(m_fd, nameWire.data(), nameWire.size(), sizeof(header)) !=
+      static_cast<ssize_t>(nameWire.size())) {
+    NDN_THROW(Error("'" + m_path + "' is truncated"));
+  }
+  try {
+    m_versionedName.wireDecode(Block(nameWire));
+  }
+  catch (const tlv::Error& e) {
+    NDN_THROW(Error("'" + m_path + "' contains an invalid name: " + e.what()));
+  }
+
+  if (header.hasLayout != 0) {
+    m_hasLayout = true;
+    m_lastSegmentNo = header.lastSegmentNo;
+    m_segmentSize = header.segmentSize;
+    mapBitmap(false);
+  }
+}
+
+void
+ResumeState::reset(const Name& versionedName)
+{
+  unmapBitmap();
+  m_versionedName = versionedName;
+  m_hasLayout = false;
+  m_lastSegmentNo = 0;
+  m_segmentSize = 0;
+  m_nWritten = 0;
+  m_earlyWritten.clear();
+
+  if (::ftruncate(m_fd, 0) != 0) {
+    NDN_THROW(Error("Cannot truncate '" + m_path + "': " + std::strerror(errno)));
+  }
+  writeHeader();
+}
+
+void
+ResumeState::setLayout(uint64_t lastSegmentNo, size_t segmentSize)
+{
+  BOOST_ASSERT(!hasLayout());
+  BOOST_ASSERT(segmentSize > 0 || lastSegmentNo == 0);
+
+  m_lastSegmentNo = lastSegmentNo;
+  m_segmentSize = segmentSize;
+  mapBitmap(true);
+
+  for (uint64_t segNo : m_earlyWritten) {
+    markWritten(segNo);
+  }
+  m_earlyWritten.clear();
+
+  // only publish the layout once the bitmap is complete
+  m_hasLayout = true;
+  writeHeader();
+}
+
+void
+ResumeState::markWritten(uint64_t segNo)
+{
+  if (m_bitmap == nullptr) {
+    m_earlyWritten.push_back(segNo);
+    return;
+  }
+
+  if (segNo > m_lastSegmentNo) {
+    return;
+  }
+  uint8_t mask = static_cast<uint8_t>(1 << (segNo % 8));
+  if ((m_bitmap[segNo / 8] & mask) == 0) {
+    m_bitmap[segNo / 8] |= mask;
+    ++m_nWritten;
+  }
+}
+
+void
+ResumeState::writeHeader()
+{
+  const Block& nameWire = m_versionedName.wireEncode();
+  if (nameWire.size() > HEADER_SIZE - sizeof(Header)) {
+    NDN_THROW(Error("Name is too long to be stored in '" + m_path + "'"));
+  }
+
+  std::vector<uint8_t> buf(sizeof(Header) + nameWire.size());
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.lastSegmentNo = m_lastSegmentNo;
+  header.segmentSize = m_segmentSize;
+  header.hasLayout = m_hasLayout ? 1 : 0;
+  header.nameSize = static_cast<uint32_t>(nameWire.size());
+  std::memcpy(buf.data(), &header, sizeof(header));
+  std::copy(nameWire.begin(), nameWire.end(), buf.begin() + sizeof(header));
+
+  if (::pwrite(m_fd, buf.data(), buf.size(), 0) != static_cast<ssize_t>(buf.size())) {
+    NDN_THROW(Error("Cannot write to '" + m_path + "': " + std::strerror(errno)));
+  }
+}
+
+void
+ResumeState::mapBitmap(bool isNew)
+{
+  m_bitmapSize = static_cast<size_t>(m_lastSegmentNo / 8 + 1);
+  off_t fileSize = static_cast<off_t>(HEADER_SIZE + m_bitmapSize);
+
+  if (isNew) {
+    if (::ftruncate(m_fd, fileSize) != 0) {
+      NDN_THROW(Error("Cannot resize '" + m_path + "': " + std::strerror(errno)));
+    }
+  }
+  else if (::lseek(m_fd, 0, SEEK_END) < fileSize) {
+    NDN_THROW(Error("'" + m_path + "' is truncated"));
+  }
+
+  void* addr = ::mmap(nullptr, m_bitmapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, HEADER_SIZE);
+  if (addr == MAP_FAILED) {
+    NDN_THROW(Error("Cannot map '" + m_path + "': " + std::strerror(errno)));
+  }
+  m_bitmap = static_cast<uint8_t*>(addr);
+
+  m_nWritten = 0;
+  for (size_t i = 0; i < m_bitmapSize; ++i) {
+    m_nWritten += std::bitset<8>(m_bitmap[i]).count();
+  }
+}
+
+void
+ResumeState::unmapBitmap()
+{
+  if (m_bitmap != nullptr) {
+    ::msync(m_bitmap, m_bitmapSize, MS_SYNC);
+    ::munmap(m_bitmap, m_bitmapSize);
+    m_bitmap = nullptr;
+    m_bitmapSize = 0;
+  }
+}
+
+} // namespace ndn::get
@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_RESUME_STATE_HPP
+#define NDN_TOOLS_GET_RESUME_STATE_HPP
+
+#include "core/common.hpp"
+
+#include <vector>
+
+namespace ndn::get {
+
+/**
+ * @brief Persistent record of the segments already written to the output file.
+ *
+ * The state file starts with a header page holding the versioned name of the content, its
+ * last segment number, and its segment size, followed by a memory-mapped bitmap with one bit
+ * per segment. A bit is set once the corresponding segment has been written to the output
+ * file, so that an interrupted transfer can be resumed from the segments that are missing.
+ *
+ * The file is in host byte order and is not meant to be moved between machines.
+ */
+class ResumeState : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Open the state file at @p path, creating it if it does not exist.
+   * @throw Error the file cannot be opened or is corrupted
+   */
+  explicit
+  ResumeState(const std::string& path);
+
+  ~ResumeState();
+
+  /**
+   * @brief Return whether the file describes a transfer that can be resumed.
+   *
+   * This is the case once the last segment number and the segment size have been recorded.
+   */
+  bool
+  hasLayout() const
+  {
+    return m_hasLayout;
+  }
+
+  const Name&
+  getVersionedName() const
+  {
+    return m_versionedName;
+  }
+
+  uint64_t
+  getLastSegmentNo() const
+  {
+    return m_lastSegmentNo;
+  }
+
+  size_t
+  getSegmentSize() const
+  {
+    return m_segmentSize;
+  }
+
+  /**
+   * @brief Start recording a new transfer of @p versionedName, discarding the previous state.
+   */
+  void
+  reset(const Name& versionedName);
+
+  /**
+   * @brief Record the last segment number and the segment size of the content.
+   *
+   * Creates the segment bitmap, including the segments marked as written before this call.
+   * @p segmentSize can be zero only if the content consists of a single segment.
+   * @pre reset() has been called and hasLayout() is false
+   */
+  void
+  setLayout(uint64_t lastSegmentNo, size_t segmentSize);
+
+  bool
+  isWritten(uint64_t segNo) const
+  {
+    if (m_bitmap == nullptr) {
+      return false;
+    }
+    return segNo <= m_lastSegmentNo && (m_bitmap[segNo / 8] & (1 << (segNo % 8))) != 0;
+  }
+
+  /**
+   * @brief Record that segment @p segNo has been written to the output file.
+   */
+  void
+  markWritten(uint64_t segNo);
+
+  /**
+   * @brief Return the number of segments recorded as written.
+   */
+  uint64_t
+  getNWritten() const
+  {
+    return m_nWritten;
+  }
+
+private:
+  void
+  load();
+
+  void
+  writeHeader();
+
+  void
+  mapBitmap(bool isNew);
+
+  void
+  unmapBitmap();
+
+private:
+  std::string m_path;
+  int m_fd = -1;
+
+  Name m_versionedName;
+  bool m_hasLayout = false;
+  uint64_t m_lastSegmentNo = 0;
+  size_t m_segmentSize = 0;
+
+  uint8_t* m_bitmap = nullptr;
+  size_t m_bitmapSize = 0;
+  uint64_t m_nWritten = 0;
+  std::vector<uint64_t> m_earlyWritten; ///< segments written before the layout was known
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_RESUME_STATE_HPP
@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "rtt-histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ndn::get {
+
+namespace {
+
+constexpr double MIN_RTT_NS = 1e3;
+constexpr double BUCKET_GROWTH = 1.01;
+constexpr size_t N_BUCKETS = 2100; ///< 1us * 1.01^2100 is about 20 minutes
+
+size_t
+getBucket(time::nanoseconds rtt)
+{
+  double ns = static_cast<double>(rtt.count());
+  if (ns <= MIN_RTT_NS) {
+    return 0;
+  }
+  auto bucket = static_cast<size_t>(std::log(ns / MIN_RTT_NS) / std::log(BUCKET_GROWTH));
+  return std::min(bucket, N_BUCKETS - 1);
+}
+
+} // namespace
+
+void
+RttHistogram::add(time::nanoseconds rtt)
+{
+  if (m_counts.empty()) {
+    m_counts.resize(N_BUCKETS);
+  }
+  m_counts[getBucket(rtt)]++;
+  m_nSamples++;
+}
+
+time::nanoseconds
+RttHistogram::getPercentile(double p) const
+{
+  BOOST_ASSERT(m_nSamples > 0);
+  BOOST_ASSERT(p >= 0.0 && p <= 1.0);
+
+  // rank of the sample, starting at 1
+  auto rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(p * m_nSamples)), 1);
+  uint64_t nSeen = 0;
+  size_t bucket = 0;
+  for (; bucket < m_counts.size(); ++bucket) {
+    nSeen += m_counts[bucket];
+    if (nSeen >= rank) {
+      break;
+    }
+  }
+
+  // the geometric middle of the bucket
+  double ns = MIN_RTT_NS * std::pow(BUCKET_GROWTH, bucket + 0.5);
+  return time::nanoseconds(static_cast<time::nanoseconds::rep>(ns));
+}
+
+void
+RttHistogram::clear()
+{
+  std::fill(m_counts.begin(), m_counts.end(), 0);
+  m_nSamples = 0;
+}
+
+} // namespace ndn::get
@@ -0,0 +1,75 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_RTT_HISTOGRAM_HPP
+#define NDN_TOOLS_GET_RTT_HISTOGRAM_HPP
+
+#include "core/common.hpp"
+
+#include <vector>
+
+namespace ndn::get {
+
+/**
+ * @brief Distribution of the RTT samples of a transfer, from which percentiles are computed.
+ *
+ * The samples are counted in buckets whose bounds grow geometrically by 1% from 1 microsecond
+ * up to about 20 minutes, so that the memory used does not depend on the number of samples and
+ * every percentile is accurate to within 0.5%. Samples outside of this range are counted in
+ * the first or last bucket.
+ */
+class RttHistogram
+{
+public:
+  void
+  add(time::nanoseconds rtt);
+
+  uint64_t
+  getNSamples() const
+  {
+    return m_nSamples;
+  }
+
+  /**
+   * @brief Return the RTT below which a fraction @p p of the samples fall.
+   * @param p between 0 and 1
+   * @pre getNSamples() > 0
+   */
+  time::nanoseconds
+  getPercentile(double p) const;
+
+  /**
+   * @brief Remove all samples, keeping the memory allocated for the buckets.
+   */
+  void
+  clear();
+
+private:
+  std::vector<uint64_t> m_counts; ///< allocated when the first sample is added
+  uint64_t m_nSamples = 0;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_RTT_HISTOGRAM_HPP
@@ -0,0 +1,55 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "segment-queue.hpp"
+
+#include <algorithm>
+
+namespace ndn::get {
+
+void
+SegmentQueue::pushLost(uint64_t segNo, int retxCount, size_t pathId)
+{
+  m_lost.push_back({segNo, retxCount, pathId});
+
+  if (m_onLoss) {
+    m_onLoss(pathId);
+  }
+}
+
+std::optional<SegmentQueue::LostSegment>
+SegmentQueue::popLost(size_t pathId)
+{
+  auto it = std::find_if(m_lost.begin(), m_lost.end(),
+                         [pathId] (const LostSegment& lost) { return lost.pathId != pathId; });
+  if (it == m_lost.end()) {
+    return std::nullopt;
+  }
+
+  LostSegment lost = *it;
+  m_lost.erase(it);
+  return lost;
+}
+
+} // namespace ndn::get
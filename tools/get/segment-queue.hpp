@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_SEGMENT_QUEUE_HPP
+#define NDN_TOOLS_GET_SEGMENT_QUEUE_HPP
+
+#include "core/common.hpp"
+
+#include <deque>
+#include <functional>
+#include <optional>
+
+namespace ndn::get {
+
+/**
+ * @brief Segments shared by the pipelines that retrieve the same content over different paths.
+ *
+ * Each pipeline takes the next segment to request from the queue whenever its window allows,
+ * so that the paths share the segments in proportion to their throughput. A segment lost on one
+ * path is put back into the queue, and is retransmitted by the next pipeline of another path
+ * that has room in its window.
+ */
+class SegmentQueue : noncopyable
+{
+public:
+  struct LostSegment
+  {
+    uint64_t segNo;
+    int retxCount;  ///< number of times the segment has already been retransmitted
+    size_t pathId;  ///< path on which the segment was lost
+  };
+
+  using LossCallback = std::function<void(size_t pathId)>;
+
+  /**
+   * @param onLoss invoked after a segment lost on path `pathId` has been queued, may be empty
+   */
+  explicit
+  SegmentQueue(LossCallback onLoss = nullptr)
+    : m_onLoss(std::move(onLoss))
+  {
+  }
+
+  /**
+   * @brief Return the number of the next segment that has never been requested.
+   */
+  uint64_t
+  getNextSegmentNo()
+  {
+    if (m_nextSegmentNo == m_skippedSegNo) {
+      m_nextSegmentNo++;
+    }
+    return m_nextSegmentNo++;
+  }
+
+  /**
+   * @brief Never return @p segNo from getNextSegmentNo(), because it has been obtained
+   *        by other means.
+   */
+  void
+  skipSegment(uint64_t segNo)
+  {
+    m_skippedSegNo = segNo;
+  }
+
+  /**
+   * @brief Return the number of segments that have been requested so far.
+   */
+  uint64_t
+  getNRequested() const
+  {
+    return m_nextSegmentNo;
+  }
+
+  /**
+   * @brief Queue segment @p segNo, lost on path @p pathId, for retransmission on another path.
+   */
+  void
+  pushLost(uint64_t segNo, int retxCount, size_t pathId);
+
+  /**
+   * @brief Take the oldest lost segment that was not lost on path @p pathId, if any.
+   */
+  std::optional<LostSegment>
+  popLost(size_t pathId);
+
+  size_t
+  getNLost() const
+  {
+    return m_lost.size();
+  }
+
+private:
+  LossCallback m_onLoss;
+  uint64_t m_nextSegmentNo = 0;
+  std::optional<uint64_t> m_skippedSegNo;
+  std::deque<LostSegment> m_lost;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_SEGMENT_QUEUE_HPP
@@ -0,0 +1,186 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "segment-table.hpp"
+
+#include <algorithm>
+
+namespace ndn::get {
+
+static size_t
+roundUpToPowerOfTwo(uint64_t n)
+{
+  size_t p = 1;
+  while (p < n) {
+    p <<= 1;
+  }
+  return p;
+}
+
+SegmentTable::SegmentTable(size_t capacity)
+  : m_slots(roundUpToPowerOfTwo(std::max<size_t>(capacity, 1)))
+  , m_mask(m_slots.size() - 1)
+{
+}
+
+void
+SegmentTable::setStride(uint64_t stride)
+{
+  BOOST_ASSERT(stride > 0);
+  BOOST_ASSERT(m_size == 0);
+  m_stride = stride;
+}
+
+SegmentInfo&
+SegmentTable::insert(uint64_t segNo)
+{
+  size_t i = findSlot(segNo);
+  if (i < m_slots.size()) {
+    return m_slots[i].info;
+  }
+
+  // keep free slots, so that the segments stored after their own slot are found quickly
+  if ((m_size + 1) * 4 > m_slots.size() * 3) {
+    rehash(m_slots.size() * 2);
+  }
+
+  Slot slot;
+  slot.segNo = segNo;
+  slot.isUsed = true;
+  i = place(std::move(slot));
+  ++m_size;
+  return m_slots[i].info;
+}
+
+size_t
+SegmentTable::place(Slot&& slot)
+{
+  size_t i = getHomeSlot(slot.segNo);
+  size_t placed = m_slots.size();
+  for (size_t dist = 0; m_slots[i].isUsed; ++dist) {
+    size_t otherDist = getDistance(i);
+    if (otherDist < dist) {
+      // take the slot of a record that is closer to its own slot, then go on placing that one
+      std::swap(slot, m_slots[i]);
+      if (placed == m_slots.size()) {
+        placed = i;
+      }
+      dist = otherDist;
+    }
+    i = (i + 1) & m_mask;
+  }
+
+  m_slots[i] = std::move(slot);
+  return placed == m_slots.size() ? i : placed;
+}
+
+bool
+SegmentTable::erase(uint64_t segNo)
+{
+  size_t i = findSlot(segNo);
+  if (i == m_slots.size()) {
+    return false;
+  }
+
+  eraseSlot(i);
+  return true;
+}
+
+void
+SegmentTable::eraseSlot(size_t i)
+{
+  m_slots[i].isUsed = false;
+  m_slots[i].info = {};
+  --m_size;
+
+  // the following records that are not in their own slot move back by one slot
+  for (size_t j = (i + 1) & m_mask; m_slots[j].isUsed && getDistance(j) > 0; j = (j + 1) & m_mask) {
+    m_slots[i] = std::move(m_slots[j]);
+    m_slots[j].isUsed = false;
+    m_slots[j].info = {};
+    i = j;
+  }
+}
+
+size_t
+SegmentTable::eraseGreaterThan(uint64_t segNo)
+{
+  size_t nErased = 0;
+  for (auto& slot : m_slots) {
+    if (slot.isUsed && slot.segNo > segNo) {
+      slot.isUsed = false;
+      slot.info = {};
+      ++nErased;
+    }
+  }
+  if (nErased > 0) {
+    m_size -= nErased;
+    // the remaining records may no longer be found from their own slot
+    rehash(m_slots.size());
+  }
+  return nErased;
+}
+
+void
+SegmentTable::clear()
+{
+  for (auto& slot : m_slots) {
+    slot.isUsed = false;
+    slot.info = {};
+  }
+  m_size = 0;
+}
+
+void
+SegmentTable::rehash(size_t capacity)
+{
+  BOOST_ASSERT(capacity > m_size);
+  std::vector<Slot> slots(capacity);
+  slots.swap(m_slots);
+  m_mask = capacity - 1;
+
+  for (auto& slot : slots) {
+    if (slot.isUsed) {
+      place(std::move(slot));
+    }
+  }
+}
+
+std::ostream&
+operator<<(std::ostream& os, SegmentState state)
+{
+  switch (state) {
+  case SegmentState::FirstTimeSent:
+    os << "FirstTimeSent";
+    break;
+  case SegmentState::InRetxQueue:
+    os << "InRetxQueue";
+    break;
+  case SegmentState::Retransmitted:
+    os << "Retransmitted";
+    break;
+  }
+  return os;
+}
+
+} // namespace ndn::get
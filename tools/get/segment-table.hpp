@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_SEGMENT_TABLE_HPP
+#define NDN_TOOLS_GET_SEGMENT_TABLE_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/face.hpp>
+
+#include <vector>
+
+namespace ndn::get {
+
+/**
+ * @brief indicates the state of the segment
+ */
+enum class SegmentState {
+  FirstTimeSent, ///< segment has been sent for the first time
+  InRetxQueue,   ///< segment is in retransmission queue
+  Retransmitted, ///< segment has been retransmitted
+};
+
+std::ostream&
+operator<<(std::ostream& os, SegmentState state);
+
+/**
+ * @brief Wraps up information that's necessary for segment transmission
+ */
+struct SegmentInfo
+{
+  ScopedPendingInterestHandle interestHdl;
+  time::steady_clock::time_point timeSent;
+  time::nanoseconds rto;
+  time::milliseconds lifetime = 0_ms; ///< InterestLifetime of the last transmission
+  SegmentState state = SegmentState::FirstTimeSent;
+  int retxCount = 0; ///< number of times the segment has been retransmitted
+};
+
+/**
+ * @brief Per-segment state of the sent-but-not-acked segments of an adaptive pipeline.
+ *
+ * The records are stored in a ring array indexed by segment number modulo its capacity, instead
+ * of a hash table. The capacity is a power of two that is sized to the number of records, i.e.,
+ * to the window of the pipeline: it is doubled whenever the table would be more than 3/4 full.
+ * The in-flight segments usually have consecutive numbers and thus occupy their own slot, but
+ * they may also be far apart, e.g., when the segments are taken from a queue shared with other
+ * paths. A segment whose slot is used by another one is stored in one of the following slots,
+ * which are kept ordered by the slot of their segment (Robin Hood hashing), so that a lookup or
+ * an erasure stops at the first record that is closer to its own slot.
+ *
+ * A pipeline that only fetches every n-th segment sets a stride of n, so that its segments
+ * occupy consecutive slots.
+ */
+class SegmentTable : noncopyable
+{
+public:
+  explicit
+  SegmentTable(size_t capacity = 64);
+
+  /**
+   * @brief Set the distance between the numbers of consecutive segments stored in the table.
+   * @pre the table is empty
+   */
+  void
+  setStride(uint64_t stride);
+
+  /**
+   * @brief Return the record of segment @p segNo, or nullptr if it is not in the table.
+   */
+  SegmentInfo*
+  find(uint64_t segNo)
+  {
+    size_t i = findSlot(segNo);
+    return i < m_slots.size() ? &m_slots[i].info : nullptr;
+  }
+
+  const SegmentInfo*
+  find(uint64_t segNo) const
+  {
+    return const_cast<SegmentTable*>(this)->find(segNo);
+  }
+
+  /**
+   * @brief Return the record of segment @p segNo, inserting a default-constructed one if needed.
+   */
+  SegmentInfo&
+  insert(uint64_t segNo);
+
+  /**
+   * @brief Remove the record of segment @p segNo, cancelling its pending Interest (if any).
+   * @return whether a record was removed
+   */
+  bool
+  erase(uint64_t segNo);
+
+  /**
+   * @brief Remove the records of all segments numbered higher than @p segNo.
+   * @return the number of records removed
+   */
+  size_t
+  eraseGreaterThan(uint64_t segNo);
+
+  /**
+   * @brief Return the retransmission count of segment @p segNo, or 0 if it is not in the table.
+   */
+  int
+  getRetxCount(uint64_t segNo) const
+  {
+    const SegmentInfo* info = find(segNo);
+    return info == nullptr ? 0 : info->retxCount;
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_slots.size();
+  }
+
+  void
+  clear();
+
+private:
+  struct Slot
+  {
+    uint64_t segNo = 0;
+    bool isUsed = false;
+    SegmentInfo info;
+  };
+
+  /**
+   * @brief Return the index of the slot in which the record of segment @p segNo would be stored
+   *        if there were no other records.
+   */
+  size_t
+  getHomeSlot(uint64_t segNo) const
+  {
+    return (segNo / m_stride) & m_mask;
+  }
+
+  /**
+   * @brief Return how far the record in slot @p i is from its own slot.
+   */
+  size_t
+  getDistance(size_t i) const
+  {
+    return (i - getHomeSlot(m_slots[i].segNo)) & m_mask;
+  }
+
+  /**
+   * @brief Return the index of the slot holding the record of segment @p segNo,
+   *        or capacity() if it is not in the table.
+   */
+  size_t
+  findSlot(uint64_t segNo) const
+  {
+    size_t i = getHomeSlot(segNo);
+    for (size_t dist = 0; m_slots[i].isUsed && getDistance(i) >= dist; ++dist) {
+      if (m_slots[i].segNo == segNo) {
+        return i;
+      }
+      i = (i + 1) & m_mask;
+    }
+    return m_slots.size();
+  }
+
+  /**
+   * @brief Store the record in @p slot, which is not in the table, moving other records if needed.
+   * @return the index of the slot where it is stored
+   */
+  size_t
+  place(Slot&& slot);
+
+  /**
+   * @brief Free slot @p i, moving back the records that were stored after it because their own
+   *        slot was used.
+   */
+  void
+  eraseSlot(size_t i);
+
+  /**
+   * @brief Move all the records to a new array of @p capacity slots.
+   */
+  void
+  rehash(size_t capacity);
+
+private:
+  std::vector<Slot> m_slots;
+  size_t m_mask = 0; ///< m_slots.size() - 1
+  size_t m_size = 0;
+  uint64_t m_stride = 1;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_SEGMENT_TABLE_HPP
@@ -31,11 +31,12 @@ StatisticsCollector::StatisticsCollector(PipelineInterestsAdaptive& pipeline,
   : m_osCwnd(osCwnd)
   , m_osRtt(osRtt)
 {
-  m_osCwnd << "time\tcwndsize\n";
+  m_osCwnd << "time\tcwndsize\tpacingrate\tmarkfraction\n";
   m_osRtt  << "segment\trtt\trttvar\tsrtt\trto\n";
 
-  pipeline.afterCwndChange.connect([this] (time::nanoseconds timeElapsed, double cwnd) {
-    m_osCwnd << timeElapsed.count() / 1e9 << '\t' << cwnd << '\n';
+  pipeline.afterCwndChange.connect([this, &pipeline] (time::nanoseconds timeElapsed, double cwnd) {
+    m_osCwnd << timeElapsed.count() / 1e9 << '\t' << cwnd << '\t'
+             << pipeline.getPacingRate() << '\t' << pipeline.getMarkingFraction() << '\n';
   });
 
   pipeline.afterRttMeasurement.connect([this] (const auto& sample) {
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "statistics-sampler.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace ndn::get {
+
+StatisticsSampler::StatisticsSampler(Face& face, PipelineInterestsAdaptive& pipeline,
+                                     time::nanoseconds interval, std::ostream& os,
+                                     BacklogCallback getBacklog)
+  : m_pipeline(pipeline)
+  , m_interval(interval)
+  , m_os(os)
+  , m_getBacklog(std::move(getBacklog))
+  , m_scheduler(face.getIoContext())
+  , m_startTime(time::steady_clock::now())
+  , m_rowStart(m_startTime)
+  , m_prevCounters(pipeline.getCounters())
+  , m_cwnd(pipeline.getWindowState().cwnd)
+  , m_cwndMin(m_cwnd)
+  , m_cwndMax(m_cwnd)
+  , m_cwndUpdateTime(m_startTime)
+{
+  BOOST_ASSERT(m_interval > 0_ns);
+
+  m_os << "time\tgoodput\tinterests\tretx\tmarks\tcwndmin\tcwndavg\tcwndmax\tinflight"
+          "\trttp50\trttp90\trttp99\tbacklog\n";
+
+  m_cwndConn = pipeline.afterCwndChange.connect([this] (time::nanoseconds, double cwnd) {
+    updateCwndArea(time::steady_clock::now());
+    m_cwnd = cwnd;
+    m_cwndMin = std::min(m_cwndMin, cwnd);
+    m_cwndMax = std::max(m_cwndMax, cwnd);
+  });
+
+  m_rttConn = pipeline.afterRttMeasurement.connect([this] (const auto& sample) {
+    m_rttHistogram.add(sample.rtt);
+  });
+
+  m_cancelConn = pipeline.afterCancel.connect([this] {
+    m_rowEvent.cancel();
+    writeRow();
+  });
+
+  scheduleNextRow();
+}
+
+void
+StatisticsSampler::scheduleNextRow()
+{
+  m_rowEvent = m_scheduler.schedule(m_interval, [this] {
+    writeRow();
+    scheduleNextRow();
+  });
+}
+
+void
+StatisticsSampler::writeRow()
+{
+  using namespace ndn::time;
+  auto now = steady_clock::now();
+  updateCwndArea(now);
+
+  duration<double, seconds::period> rowLength = now - m_rowStart;
+  auto counters = m_pipeline.getCounters();
+  double goodput = 0.0;
+  double cwndAvg = m_cwnd;
+  if (rowLength.count() > 0) {
+    goodput = 8 * (counters.nReceivedBytes - m_prevCounters.nReceivedBytes) / rowLength.count();
+    cwndAvg = m_cwndArea / rowLength.count();
+  }
+  // written as "nan" if there was no RTT sample during the row
+  auto getRttPercentile = [this] (double p) {
+    if (m_rttHistogram.getNSamples() == 0) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    return m_rttHistogram.getPercentile(p).count() / 1e6;
+  };
+
+  m_os << duration<double, seconds::period>(now - m_startTime).count() << '\t'
+       << goodput << '\t'
+       << counters.nSent - m_prevCounters.nSent << '\t'
+       << counters.nRetransmitted - m_prevCounters.nRetransmitted << '\t'
+       << counters.nCongMarks - m_prevCounters.nCongMarks << '\t'
+       << m_cwndMin << '\t' << cwndAvg << '\t' << m_cwndMax << '\t'
+       << counters.nInFlight << '\t'
+       << getRttPercentile(0.5) << '\t'
+       << getRttPercentile(0.9) << '\t'
+       << getRttPercentile(0.99) << '\t'
+       << (m_getBacklog ? m_getBacklog() : 0) << '\n';
+  // rows are rare, so flush them to allow following the file during the transfer
+  m_os.flush();
+
+  m_rowStart = now;
+  m_prevCounters = counters;
+  m_cwndMin = m_cwndMax = m_cwnd;
+  m_cwndArea = 0.0;
+  m_rttHistogram.clear();
+}
+
+void
+StatisticsSampler::updateCwndArea(time::steady_clock::time_point now)
+{
+  time::duration<double, time::seconds::period> elapsed = now - m_cwndUpdateTime;
+  m_cwndArea += m_cwnd * elapsed.count();
+  m_cwndUpdateTime = now;
+}
+
+} // namespace ndn::get
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_STATISTICS_SAMPLER_HPP
+#define NDN_TOOLS_GET_STATISTICS_SAMPLER_HPP
+
+#include "pipeline-interests-adaptive.hpp"
+#include "rtt-histogram.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+namespace ndn::get {
+
+/**
+ * @brief Periodic statistics sampler for Adaptive pipelines
+ *
+ * Unlike StatisticsCollector, which writes a line for every window change and RTT sample,
+ * writes a single tab-separated row per interval, aggregating the events of that interval:
+ * goodput, Interests sent, retransmissions, congestion marks, minimum, time-weighted average,
+ * and maximum congestion window, Interests in flight, RTT percentiles, and the consumer's
+ * backlog. The last row, written when the pipeline stops, may cover a shorter interval.
+ */
+class StatisticsSampler : noncopyable
+{
+public:
+  using BacklogCallback = std::function<size_t()>;
+
+  /**
+   * @param interval length of the interval covered by each row, must be positive
+   * @param getBacklog returns the number of segments held by the consumer, may be empty
+   */
+  StatisticsSampler(Face& face, PipelineInterestsAdaptive& pipeline, time::nanoseconds interval,
+                    std::ostream& os, BacklogCallback getBacklog = nullptr);
+
+private:
+  void
+  scheduleNextRow();
+
+  /**
+   * @brief Write the row of the interval that ends now, and start the next one
+   */
+  void
+  writeRow();
+
+  /**
+   * @brief Account for the time spent with the current congestion window since the last update
+   */
+  void
+  updateCwndArea(time::steady_clock::time_point now);
+
+private:
+  PipelineInterestsAdaptive& m_pipeline;
+  const time::nanoseconds m_interval;
+  std::ostream& m_os;
+  BacklogCallback m_getBacklog;
+  Scheduler m_scheduler;
+  scheduler::ScopedEventId m_rowEvent;
+  signal::ScopedConnection m_cwndConn;
+  signal::ScopedConnection m_rttConn;
+  signal::ScopedConnection m_cancelConn;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  time::steady_clock::time_point m_startTime;
+  time::steady_clock::time_point m_rowStart;
+  PipelineInterestsAdaptive::Counters m_prevCounters; ///< counters at the start of the row
+  double m_cwnd;      ///< current congestion window size
+  double m_cwndMin;   ///< smallest congestion window of the row
+  double m_cwndMax;   ///< largest congestion window of the row
+  double m_cwndArea = 0.0; ///< integral of the congestion window over the row, in segment-seconds
+  time::steady_clock::time_point m_cwndUpdateTime; ///< when m_cwndArea was last updated
+  RttHistogram m_rttHistogram; ///< RTT samples of the row
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_STATISTICS_SAMPLER_HPP
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "validation-pool.hpp"
+
+#include <boost/asio/post.hpp>
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn::get {
+
+ValidationPool::ValidationPool(boost::asio::io_context& io, size_t nThreads,
+                               const ValidatorFactory& makeValidator)
+  : m_io(io)
+{
+  BOOST_ASSERT(nThreads > 0);
+
+  for (size_t i = 0; i < nThreads; ++i) {
+    m_validators.push_back(makeValidator());
+  }
+  for (const auto& validator : m_validators) {
+    m_workers.emplace_back([this, &validator = *validator] { workerLoop(validator); });
+  }
+}
+
+ValidationPool::~ValidationPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopping = true;
+  }
+  m_cv.notify_all();
+
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+}
+
+void
+ValidationPool::validate(std::shared_ptr<const Data> data,
+                         SuccessCallback onSuccess, FailureCallback onFailure)
+{
+  // keep the I/O loop running until the verdict has been delivered
+  if (m_nOutstanding++ == 0) {
+    m_workGuard.emplace(m_io.get_executor());
+  }
+  m_maxOutstanding = std::max(m_maxOutstanding, m_nOutstanding);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back({std::move(data), std::move(onSuccess), std::move(onFailure),
+                       time::steady_clock::now()});
+  }
+  m_cv.notify_one();
+}
+
+void
+ValidationPool::workerLoop(security::Validator& validator)
+{
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this] { return m_isStopping || !m_queue.empty(); });
+      if (m_isStopping) {
+        return;
+      }
+      job = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+
+    std::optional<security::ValidationError> error;
+    bool isDone = false;
+    validator.validate(*job.data,
+      [&] (const Data&) { isDone = true; },
+      [&] (const Data&, const security::ValidationError& e) {
+        isDone = true;
+        error = e;
+      });
+    if (!isDone) {
+      error = security::ValidationError(security::ValidationError::IMPLEMENTATION_ERROR,
+                                        "Validator did not complete synchronously");
+    }
+
+    boost::asio::post(m_io, [this, job = std::move(job), error = std::move(error)] {
+      complete(job);
+      if (error) {
+        job.onFailure(job.data, *error);
+      }
+      else {
+        job.onSuccess(job.data);
+      }
+    });
+  }
+}
+
+void
+ValidationPool::complete(const Job& job)
+{
+  BOOST_ASSERT(m_nOutstanding > 0);
+  if (--m_nOutstanding == 0) {
+    m_workGuard.reset();
+  }
+
+  auto latency = time::steady_clock::now() - job.enqueueTime;
+  ++m_nValidated;
+  m_totalLatency += latency;
+  m_maxLatency = std::max<time::nanoseconds>(m_maxLatency, latency);
+}
+
+void
+ValidationPool::printSummary() const
+{
+  std::cerr << "Validation: " << m_nValidated << " packets on " << m_workers.size()
+            << " threads, max queue depth " << m_maxOutstanding << ", latency avg/max = "
+            << std::fixed << std::setprecision(3)
+            << (m_nValidated == 0 ? 0.0 : m_totalLatency.count() / 1e6 / m_nValidated) << "/"
+            << m_maxLatency.count() / 1e6 << " ms\n";
+}
+
+} // namespace ndn::get
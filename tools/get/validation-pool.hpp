@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_VALIDATION_POOL_HPP
+#define NDN_TOOLS_GET_VALIDATION_POOL_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/security/validator.hpp>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ndn::get {
+
+/**
+ * @brief Validates Data packets on a pool of worker threads.
+ *
+ * Each worker owns its own validator, created by the factory passed to the constructor, so
+ * validators never need to be thread-safe. Validation results are delivered on the thread
+ * running @p io, in the order in which validations complete.
+ *
+ * Validators must complete synchronously, i.e., they must not need to retrieve certificates
+ * from the network; a validation that does not complete within validate() is reported as
+ * a failure.
+ */
+class ValidationPool : noncopyable
+{
+public:
+  using ValidatorFactory = std::function<std::unique_ptr<security::Validator>()>;
+  using SuccessCallback = std::function<void(std::shared_ptr<const Data>)>;
+  using FailureCallback = std::function<void(std::shared_ptr<const Data>,
+                                             const security::ValidationError&)>;
+
+  /**
+   * @brief Start @p nThreads workers, each with a validator created by @p makeValidator.
+   */
+  ValidationPool(boost::asio::io_context& io, size_t nThreads, const ValidatorFactory& makeValidator);
+
+  ~ValidationPool();
+
+  /**
+   * @brief Queue @p data for validation.
+   *
+   * Exactly one of @p onSuccess or @p onFailure will be invoked on the I/O thread.
+   * Must be called from the I/O thread.
+   */
+  void
+  validate(std::shared_ptr<const Data> data, SuccessCallback onSuccess, FailureCallback onFailure);
+
+  /**
+   * @brief Return the number of Data packets queued or being validated.
+   */
+  size_t
+  getNOutstanding() const
+  {
+    return m_nOutstanding;
+  }
+
+  size_t
+  getNThreads() const
+  {
+    return m_workers.size();
+  }
+
+  void
+  printSummary() const;
+
+private:
+  struct Job
+  {
+    std::shared_ptr<const Data> data;
+    SuccessCallback onSuccess;
+    FailureCallback onFailure;
+    time::steady_clock::time_point enqueueTime;
+  };
+
+  void
+  workerLoop(security::Validator& validator);
+
+  void
+  complete(const Job& job);
+
+private:
+  boost::asio::io_context& m_io;
+  std::vector<std::unique_ptr<security::Validator>> m_validators;
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<Job> m_queue; ///< guarded by m_mutex
+  bool m_isStopping = false; ///< guarded by m_mutex
+
+  // the following members are only accessed on the I/O thread
+  size_t m_nOutstanding = 0;
+  std::optional<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> m_workGuard;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  size_t m_maxOutstanding = 0; ///< maximum validation queue depth
+  uint64_t m_nValidated = 0;   ///< number of completed validations
+  time::nanoseconds m_totalLatency = 0_ns;
+  time::nanoseconds m_maxLatency = 0_ns;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_VALIDATION_POOL_HPP
@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "vectored-writer.hpp"
+
+#include <ndn-cxx/util/exception.hpp>
+
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+
+#include <poll.h>
+
+namespace ndn::get {
+
+#ifdef IOV_MAX
+const size_t MAX_IOVCNT = IOV_MAX;
+#else
+const size_t MAX_IOVCNT = 1024;
+#endif
+
+VectoredWriter::VectoredWriter(int fd, boost::asio::io_context& io, size_t flushThreshold)
+  : m_fd(fd)
+  , m_io(io)
+  , m_flushThreshold(flushThreshold)
+{
+}
+
+void
+VectoredWriter::append(std::shared_ptr<const Data> data)
+{
+  BOOST_ASSERT(data != nullptr);
+
+  const Block& content = data->getContent();
+  if (content.value_size() == 0) {
+    return;
+  }
+
+  m_iov.push_back({const_cast<uint8_t*>(content.value()), content.value_size()});
+  m_pending.push_back(std::move(data));
+  m_nPendingBytes += content.value_size();
+}
+
+void
+VectoredWriter::flush()
+{
+  for (size_t i = 0; i < m_iov.size(); i += MAX_IOVCNT) {
+    writeAll(m_iov.data() + i, std::min(MAX_IOVCNT, m_iov.size() - i));
+  }
+
+  m_iov.clear();
+  m_pending.clear();
+  m_nPendingBytes = 0;
+}
+
+void
+VectoredWriter::requestFlush()
+{
+  if (m_nPendingBytes >= m_flushThreshold || m_iov.size() >= MAX_IOVCNT) {
+    flush();
+    return;
+  }
+
+  if (m_isFlushPending || m_iov.empty()) {
+    return;
+  }
+
+  // the Data packets that are already waiting to be processed are likely to be drained from the
+  // reorder buffer as well, write them together
+  m_isFlushPending = true;
+  boost::asio::post(m_io, [this, token = std::weak_ptr<void>(m_aliveToken)] {
+    if (token.expired()) {
+      return;
+    }
+    m_isFlushPending = false;
+    flush();
+  });
+}
+
+void
+VectoredWriter::writeAll(struct iovec* iov, size_t iovcnt)
+{
+  while (iovcnt > 0) {
+    ssize_t n = ::writev(m_fd, iov, static_cast<int>(iovcnt));
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        // the descriptor is in non-blocking mode (e.g., a pipe shared with another process)
+        pollfd pfd{m_fd, POLLOUT, 0};
+        ::poll(&pfd, 1, -1);
+        continue;
+      }
+      NDN_THROW(Error("writev: "s + std::strerror(errno)));
+    }
+
+    ++m_nWriteCalls;
+    m_nBytesWritten += static_cast<uint64_t>(n);
+
+    // skip the buffers that were fully written and adjust the first partially written one
+    auto written = static_cast<size_t>(n);
+    while (iovcnt > 0 && written >= iov->iov_len) {
+      written -= iov->iov_len;
+      ++iov;
+      --iovcnt;
+    }
+    if (iovcnt > 0) {
+      iov->iov_base = static_cast<uint8_t*>(iov->iov_base) + written;
+      iov->iov_len -= written;
+    }
+  }
+}
+
+} // namespace ndn::get
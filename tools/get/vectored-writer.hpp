@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_TOOLS_GET_VECTORED_WRITER_HPP
+#define NDN_TOOLS_GET_VECTORED_WRITER_HPP
+
+#include "core/common.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <vector>
+
+#include <sys/uio.h>
+
+namespace ndn::get {
+
+/**
+ * @brief Writes the content of a batch of Data packets to a file descriptor with writev(2).
+ *
+ * The content is written directly from the buffers of the Data packets, which are kept alive
+ * until the next flush(). This replaces one write call per segment with one system call per
+ * batch of (up to IOV_MAX) segments. With requestFlush(), the batches span the segments drained
+ * while handling several Data packets, instead of a single one.
+ */
+class VectoredWriter : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  static constexpr size_t DEFAULT_FLUSH_THRESHOLD = 256 * 1024;
+
+  /**
+   * @param io I/O context in which the deferred flushes of requestFlush() are performed
+   * @param flushThreshold number of queued bytes that requestFlush() writes right away
+   */
+  VectoredWriter(int fd, boost::asio::io_context& io, size_t flushThreshold = DEFAULT_FLUSH_THRESHOLD);
+
+  /**
+   * @brief Queue the content of @p data for output.
+   */
+  void
+  append(std::shared_ptr<const Data> data);
+
+  /**
+   * @brief Write all queued content and release the queued Data packets.
+   * @throw Error the write failed
+   */
+  void
+  flush();
+
+  /**
+   * @brief Write the queued content if at least `flushThreshold` bytes or IOV_MAX buffers are
+   *        queued, or else once the handlers that are ready to run in the I/O context have run.
+   * @throw Error the write failed; also thrown from the I/O context by a deferred flush
+   */
+  void
+  requestFlush();
+
+  /**
+   * @brief Return the number of bytes queued for output.
+   */
+  size_t
+  getNPendingBytes() const
+  {
+    return m_nPendingBytes;
+  }
+
+  /**
+   * @brief Return the number of writev calls issued so far.
+   */
+  uint64_t
+  getNWriteCalls() const
+  {
+    return m_nWriteCalls;
+  }
+
+  /**
+   * @brief Return the number of bytes written so far.
+   */
+  uint64_t
+  getNBytesWritten() const
+  {
+    return m_nBytesWritten;
+  }
+
+private:
+  void
+  writeAll(struct iovec* iov, size_t iovcnt);
+
+private:
+  int m_fd;
+  boost::asio::io_context& m_io;
+  const size_t m_flushThreshold;
+  std::vector<std::shared_ptr<const Data>> m_pending;
+  std::vector<struct iovec> m_iov;
+  size_t m_nPendingBytes = 0;
+  bool m_isFlushPending = false;
+  std::shared_ptr<void> m_aliveToken = std::make_shared<int>(); ///< expires with the writer,
+                                                                 ///< cancelling a deferred flush
+  uint64_t m_nWriteCalls = 0;
+  uint64_t m_nBytesWritten = 0;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_VECTORED_WRITER_HPP
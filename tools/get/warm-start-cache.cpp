@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#include "warm-start-cache.hpp"
+
+#include <ndn-cxx/util/exception.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <unistd.h>
+
+namespace ndn::get {
+
+WarmStartCache::WarmStartCache(const std::string& path)
+  : m_path(path)
+{
+  std::ifstream is(path);
+  if (!is.is_open()) {
+    if (errno == ENOENT) {
+      return;
+    }
+    NDN_THROW(Error("Cannot open '" + path + "': " + std::strerror(errno)));
+  }
+
+  std::string line;
+  while (std::getline(is, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::istringstream iss(line);
+    std::string uri;
+    int64_t timestamp = 0, sRtt = 0, rttVar = 0;
+    Entry entry{};
+    if (!(iss >> uri >> timestamp >> sRtt >> rttVar >> entry.cwnd >> entry.ssthresh) ||
+        !(iss >> std::ws).eof() || sRtt < 0 || rttVar < 0 ||
+        !(entry.cwnd > 0.0) || !(entry.ssthresh > 0.0)) {
+      ++m_nSkippedLines;
+      continue;
+    }
+
+    Name prefix;
+    try {
+      prefix = Name(uri);
+    }
+    catch (const Name::Error&) {
+      ++m_nSkippedLines;
+      continue;
+    }
+
+    entry.timestamp = time::fromUnixTimestamp(time::milliseconds(timestamp));
+    entry.sRtt = time::microseconds(sRtt);
+    entry.rttVar = time::microseconds(rttVar);
+    m_entries[prefix] = entry;
+  }
+
+  if (is.bad()) {
+    NDN_THROW(Error("Cannot read '" + path + "'"));
+  }
+}
+
+Name
+WarmStartCache::getRoutablePrefix(const Name& name, const std::vector<Name>& forwardingHint)
+{
+  if (!forwardingHint.empty()) {
+    return forwardingHint.front();
+  }
+
+  Name prefix = name;
+  while (!prefix.empty() && (prefix[-1].isSegment() || prefix[-1].isVersion())) {
+    prefix = prefix.getPrefix(-1);
+  }
+  // the last component names the object, not the producer
+  if (prefix.size() > 1) {
+    prefix = prefix.getPrefix(-1);
+  }
+  return prefix;
+}
+
+const WarmStartCache::Entry*
+WarmStartCache::find(const Name& name, time::nanoseconds maxAge) const
+{
+  auto now = time::system_clock::now();
+  for (size_t len = name.size() + 1; len-- > 0;) {
+    auto it = m_entries.find(name.getPrefix(len));
+    if (it != m_entries.end() && now - it->second.timestamp < maxAge) {
+      return &it->second;
+    }
+  }
+  return nullptr;
+}
+
+void
+WarmStartCache::insert(const Name& prefix, const Entry& entry)
+{
+  m_entries[prefix] = entry;
+}
+
+void
+WarmStartCache::save(time::nanoseconds maxAge) const
+{
+  std::string tmpPath = m_path + ".tmp." + std::to_string(::getpid());
+  std::ofstream os(tmpPath, std::ios::trunc);
+  if (!os.is_open()) {
+    NDN_THROW(Error("Cannot open '" + tmpPath + "': " + std::strerror(errno)));
+  }
+
+  auto now = time::system_clock::now();
+  os << "# prefix timestamp(ms) srtt(us) rttvar(us) cwnd ssthresh\n"
+     << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (const auto& [prefix, entry] : m_entries) {
+    if (now - entry.timestamp >= maxAge) {
+      continue;
+    }
+    os << prefix << ' '
+       << time::toUnixTimestamp(entry.timestamp).count() << ' '
+       << time::duration_cast<time::microseconds>(entry.sRtt).count() << ' '
+       << time::duration_cast<time::microseconds>(entry.rttVar).count() << ' '
+       << entry.cwnd << ' ' << entry.ssthresh << '\n';
+  }
+
+  os.close();
+  if (os.fail()) {
+    std::remove(tmpPath.c_str());
+    NDN_THROW(Error("Cannot write '" + tmpPath + "'"));
+  }
+  if (std::rename(tmpPath.c_str(), m_path.c_str()) != 0) {
+    int err = errno;
+    std::remove(tmpPath.c_str());
+    NDN_THROW(Error("Cannot replace '" + m_path + "': " + std::strerror(err)));
+  }
+}
+
+time::nanoseconds
+WarmStartCache::getInitialRto(const Entry& entry, const util::RttEstimator::Options& rttOptions)
+{
+  auto rto = entry.sRtt + rttOptions.k * entry.rttVar;
+  return std::clamp<time::nanoseconds>(rto, rttOptions.minRto, rttOptions.maxRto);
+}
+
+PipelineInterestsAdaptive::WindowState
+WarmStartCache::getInitialWindow(const Entry& entry, double initCwnd)
+{
+  return {std::max(entry.cwnd / 2.0, initCwnd), entry.ssthresh};
+}
+
+} // namespace ndn::get
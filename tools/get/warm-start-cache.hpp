@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026, Regents of the University of California,
+ *                     Colorado State University,
+ *                     University Pierre & Marie Curie, Sorbonne University.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+
+#ifndef NDN_TOOLS_GET_WARM_START_CACHE_HPP
+#define NDN_TOOLS_GET_WARM_START_CACHE_HPP
+
+#include "pipeline-interests-adaptive.hpp"
+
+#include <map>
+
+namespace ndn::get {
+
+/**
+ * @brief Persistent record of the RTT and congestion window reached by previous transfers,
+ *        used to start new transfers over the same path without a cold window.
+ *
+ * The cache file is a text file with one line per routable prefix, in the format
+ * `prefix timestamp srtt rttvar cwnd ssthresh`, where the timestamp is in milliseconds
+ * since the Unix epoch and the RTTs are in microseconds. Lines starting with '#' are ignored.
+ * Malformed lines are skipped, since the cache is only a hint, and are dropped by the next save().
+ */
+class WarmStartCache : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  struct Entry
+  {
+    time::system_clock::time_point timestamp; ///< when the entry was recorded
+    time::nanoseconds sRtt;   ///< smoothed RTT at the end of the transfer
+    time::nanoseconds rttVar; ///< RTT variation at the end of the transfer
+    double cwnd;              ///< congestion window at the end of the transfer
+    double ssthresh;          ///< slow start threshold at the end of the transfer
+  };
+
+  /**
+   * @brief Load the cache file at @p path. A file that does not exist is an empty cache.
+   * @throw Error the file cannot be read
+   */
+  explicit
+  WarmStartCache(const std::string& path);
+
+  /**
+   * @brief Return the number of malformed lines skipped while loading the cache file.
+   */
+  size_t
+  getNSkippedLines() const
+  {
+    return m_nSkippedLines;
+  }
+
+  /**
+   * @brief Return the prefix under which the transfers of @p name are recorded.
+   *
+   * This is the forwarding hint if there is one, otherwise the name without its version,
+   * segment, and last components, i.e., the namespace of the producer of the object.
+   */
+  static Name
+  getRoutablePrefix(const Name& name, const std::vector<Name>& forwardingHint = {});
+
+  /**
+   * @brief Find the entry of the longest prefix of @p name recorded less than @p maxAge ago
+   * @return the entry, or nullptr if there is none
+   */
+  const Entry*
+  find(const Name& name, time::nanoseconds maxAge) const;
+
+  /**
+   * @brief Record @p entry for @p prefix, replacing the previous entry of the same prefix.
+   */
+  void
+  insert(const Name& prefix, const Entry& entry);
+
+  /**
+   * @brief Write the cache to its file, dropping the entries recorded more than @p maxAge ago.
+   *
+   * The file is replaced atomically, so that concurrent transfers never read a partial file.
+   * @throw Error the file cannot be written
+   */
+  void
+  save(time::nanoseconds maxAge) const;
+
+  /**
+   * @brief Return the initial retransmission timeout of a transfer warm-started from @p entry.
+   *
+   * This is the RTO computed from the recorded smoothed RTT and RTT variation, within the
+   * bounds of @p rttOptions.
+   */
+  static time::nanoseconds
+  getInitialRto(const Entry& entry, const util::RttEstimator::Options& rttOptions);
+
+  /**
+   * @brief Return the initial window of a transfer warm-started from @p entry.
+   *
+   * The window starts at half of the recorded one, but not below @p initCwnd, and slow start
+   * ends at the recorded threshold; the window thus regains its previous size within one RTT,
+   * without the risk of sending a full window at once over a path whose state may have changed.
+   */
+  static PipelineInterestsAdaptive::WindowState
+  getInitialWindow(const Entry& entry, double initCwnd);
+
+private:
+  std::string m_path;
+  size_t m_nSkippedLines = 0;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  std::map<Name, Entry> m_entries;
+};
+
+} // namespace ndn::get
+
+#endif // NDN_TOOLS_GET_WARM_START_CACHE_HPP